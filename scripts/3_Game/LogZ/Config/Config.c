@@ -67,11 +67,11 @@ class LogZ_Config
 		// Setup logs paths and rotation
 		InitLogging();
 
-		// Init geo cache (requires resolved world_effective_size)
-		LogZ_Geo.Init();
-
 		// Finalize loading (only now we are truly loaded)
 		SetLoaded();
+
+		// Init geo cache (requires resolved world_effective_size and loaded config)
+		LogZ_Geo.Init();
 	}
 
 	/**
@@ -157,42 +157,55 @@ class LogZ_Config
 			s_Config.file.full_path = s_Config.file.base_path + LogZ_Constants.LOG_EXT;
 		}
 
-		// Handle Rotation (works for both legacy and new structure)
-		if (s_Config.file.rotation_keep > 1)
-			RotateLogs();
+		PrepareLogFile(s_Config.file);
 
-		// Handle Truncate if not appending and rotation is off (or after rotation)
-		if (!s_Config.file.append) {
-			FileHandle fh = OpenFile(s_Config.file.full_path, FileMode.WRITE); // truncate
-			if (fh)
-				CloseFile(fh);
+		// Routed files always use new directory structure
+		foreach (LogZ_ConfigDTO_Route route : s_Config.routes) {
+			if (!route || route.name == string.Empty)
+				continue;
+
+			if (!FileExist(LogZ_Constants.LOGS_DIR))
+				MakeDirectory(LogZ_Constants.LOGS_DIR);
+
+			string routeFileName = route.file.file_name;
+			if (routeFileName == string.Empty)
+				routeFileName = string.Format("logz_%1_%2", s_Config.settings.instance_id_resolved, route.name);
+
+			route.file.base_path = LogZ_Constants.LOGS_DIR + routeFileName;
+			route.file.full_path = route.file.base_path + LogZ_Constants.LOG_EXT;
+
+			PrepareLogFile(route.file);
 		}
 	}
 
 	/**
-	    \brief Rotates log files shifting .N -> .N+1
+	    \brief Handles startup rotation and truncation for a resolved log file.
 	*/
-	protected void RotateLogs()
+	protected void PrepareLogFile(LogZ_ConfigDTO_File cfgFile)
 	{
-		string ext = LogZ_Constants.LOG_EXT;
-
-		// delete last
-		string last = string.Format("%1.%2%3", s_Config.file.base_path, s_Config.file.rotation_keep - 1, ext);
-		if (FileExist(last))
-			DeleteFile(last);
+		// Time-windowed segments are opened, appended and pruned by the sink
+		if (cfgFile.segment_seconds > 0) {
+			cfgFile.full_path = LogZ_Rotation.SegmentPath(cfgFile, LogZ_Time.EpochSecondsUTC());
+			return;
+		}
 
-		// shift .N-1 -> .N, ..., .0 -> .1, base -> .0
-		for (int i = s_Config.file.rotation_keep - 2; i >= 0; i--) {
-			string srcLog = s_Config.file.full_path;
-			if (i != 0)
-				srcLog = string.Format("%1.%2%3", s_Config.file.base_path, i, ext);
+		// Generation mode always writes "<base>.<N>.ndjson", keep clamped same as runtime rotation
+		if (cfgFile.rotation_generations) {
+			int keep = cfgFile.rotation_keep;
+			if (keep < 2)
+				keep = 2;
 
-			string dstLog = string.Format("%1.%2%3", s_Config.file.base_path, i + 1, ext);
+			LogZ_Rotation.NextGeneration(cfgFile, keep);
+		} else if (cfgFile.rotation_keep > 1) {
+			// Handle Rotation (works for both legacy and new structure)
+			LogZ_Rotation.Rotate(cfgFile, cfgFile.rotation_keep);
+		}
 
-			if (FileExist(srcLog)) {
-				CopyFile(srcLog, dstLog);
-				DeleteFile(srcLog);
-			}
+		// Handle Truncate if not appending and rotation is off (or after rotation)
+		if (!cfgFile.append) {
+			FileHandle fh = OpenFile(cfgFile.full_path, FileMode.WRITE); // truncate
+			if (fh)
+				CloseFile(fh);
 		}
 	}
 
@@ -206,6 +219,10 @@ class LogZ_Config
 
 		s_Loaded = true;
 
+		// Static envelope fields are resolved only now
+		LogZ_DTO_Root.BuildEnvelope();
+		LogZ_JsonWriter.SetOmitEmpty(s_Config.settings.compact);
+
 #ifdef DIAG
 		DebugConfig();
 #else
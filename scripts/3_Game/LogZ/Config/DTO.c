@@ -14,10 +14,13 @@ class LogZ_ConfigDTO
 	{
 		settings = new LogZ_ConfigDTO_Settings();
 		file = new LogZ_ConfigDTO_File();
+		http = new LogZ_ConfigDTO_Http();
 		filters = new LogZ_ConfigDTO_Filters();
 		throttling = new LogZ_ConfigDTO_Throttling();
 		thresholds = new LogZ_ConfigDTO_Thresholds();
 		geo = new LogZ_ConfigDTO_Geo();
+		fields = new LogZ_ConfigDTO_Fields();
+		routes = new array<ref LogZ_ConfigDTO_Route>();
 	}
 
 	// Internal configuration version. **Do not modify**.
@@ -29,6 +32,9 @@ class LogZ_ConfigDTO
 	// File output and rotation settings.
 	ref LogZ_ConfigDTO_File file;
 
+	// Push buffered logs over HTTP instead of (or in addition to) the file.
+	ref LogZ_ConfigDTO_Http http;
+
 	// Logic filters for specific events.
 	ref LogZ_ConfigDTO_Filters filters;
 
@@ -41,6 +47,14 @@ class LogZ_ConfigDTO
 	// Geographic coordinate settings.
 	ref LogZ_ConfigDTO_Geo geo;
 
+	// Optional fields of object snapshots.
+	// Disabled fields are not read from the game and are omitted from output.
+	ref LogZ_ConfigDTO_Fields fields;
+
+	// Route events to separate NDJSON files.
+	// Each event goes to the first route whose `events_mask` matches it, other events go to `file`.
+	ref array<ref LogZ_ConfigDTO_Route> routes;
+
 	/**
 	    \brief Normalizes configuration values within valid ranges.
 	*/
@@ -48,10 +62,28 @@ class LogZ_ConfigDTO
 	{
 		settings.Normalize();
 		file.Normalize();
+
+		if (!http)
+			http = new LogZ_ConfigDTO_Http();
+
+		http.Normalize();
 		filters.Normalize();
 		throttling.Normalize();
 		thresholds.Normalize();
 		geo.Normalize();
+
+		if (!fields)
+			fields = new LogZ_ConfigDTO_Fields();
+
+		fields.Normalize();
+
+		if (!routes)
+			routes = new array<ref LogZ_ConfigDTO_Route>();
+
+		foreach (LogZ_ConfigDTO_Route route : routes) {
+			if (route)
+				route.Normalize();
+		}
 	}
 }
 
@@ -75,8 +107,20 @@ class LogZ_ConfigDTO_Settings
 	// Event mask configuration.
 	// Can be a specific bitmask integer or a string of characters representing event categories.
 	// Example: "ABKqz" or "-1" (for all).
+	// Event types registered by other mods can be enabled only by integer mask or "-1".
 	string events_mask = "ABCDEFGHIJKLMOPQSTUVWXYZ";
 
+	// Add `ts_ms` field with UTC time in milliseconds next to `ts`.
+	// Milliseconds are server uptime plus an offset to wall clock, calibrated on a second
+	// boundary every 60 s. Error is up to one server frame (50 ms above 20 FPS) plus uptime drift.
+	// When enabled `ts` seconds are taken from the same clock, so `ts` and `ts_ms` always match.
+	bool timestamp_ms;
+
+	// Omit optional object fields with zero, `false` or empty values (omitempty),
+	// e.g. `em`, `em_on`, `agent`, `liquid` of items or `player_name`, `steam_id` of AI.
+	// Missing field means zero value, `id`, `pos`, `health` and envelope fields are always written.
+	bool compact;
+
 	// Disable send minimal telemetry 10-20 minutes after server startup.
 	bool disable_telemetry;
 
@@ -112,17 +156,7 @@ class LogZ_ConfigDTO_Settings
 		level_enum = LogZ_Levels.FromString(level);
 
 		// Convert string mask to int
-		if (LogZ_Utils.HasAlpha(events_mask))
-			events_mask_int = LogZ_Events.FromString(events_mask);
-		else
-			events_mask_int = events_mask.ToInt();
-
-		if (events_mask_int == -1)
-			events_mask_int = LogZ_Event.MAX;
-		else if (events_mask_int <= LogZ_Event.NONE)
-			events_mask_int = LogZ_Event.NONE;
-		else if (events_mask_int >= LogZ_Event.MAX)
-			events_mask_int = LogZ_Event.MAX;
+		events_mask_int = LogZ_Helpers.ParseEventsMask(events_mask);
 	}
 }
 
@@ -142,19 +176,87 @@ class LogZ_ConfigDTO_File
 	// > 1    - Keeps N rotated files (e.g., .0.ndjson, .1.ndjson).
 	int rotation_keep = 5;
 
+	// Rotation naming scheme.
+	// "shift" - Active file is `logz_1.ndjson`, on rotation files are copied .N -> .N+1 (cost grows with log size).
+	// Used only for startup rotation, `max_file_bytes` switches to "generation".
+	// "generation" - Active file is `logz_1.<N>.ndjson` with increasing N, rotation only opens
+	// a new file and deletes the oldest one. Point collectors to `logz_1.*.ndjson`.
+	string rotation_mode = "shift";
+
+	// Maximum log file size in bytes before it is rotated at runtime.
+	// 0 - Disable, rotate only on server start.
+	// > 0 - Rotate when this size is written, at least one previous file is kept.
+	// Implies "generation" `rotation_mode`, runtime rotation never copies log files.
+	// Size is counted from server start, each start opens a new generation file,
+	// so `append` never continues a file with uncounted data.
+	int max_file_bytes;
+
+	// Split logs into time-windowed segments by UTC wall clock.
+	// "" - Disabled, single log file with rotation.
+	// "hour" - New file every hour, e.g. `logz_1_2026101714.ndjson`.
+	// "day" - New file every day, e.g. `logz_1_20261017.ndjson`.
+	// Segments older than `rotation_keep` windows are deleted, `max_file_bytes` is ignored.
+	string segment;
+
 	// Buffer size (in lines) for file writing.
 	// 0 - Disable buffer, write each line immediately (Direct mode).
 	// > 0 - Accumulate lines until this limit is reached.
 	int buffer_size = 32;
 
+	// Buffer size (in bytes) for file writing.
+	// 0 - Disable byte limit, flush only by `buffer_size` lines.
+	// > 0 - Flush when buffered lines reach this size, whichever limit is hit first.
+	int buffer_bytes = 65536;
+
+	// Maximum bytes written to disk per server frame when flushing a full buffer.
+	// 0 - Disable incremental flush, write the whole buffer at once.
+	// > 0 - Spread the flush across frames, lines are never split.
+	int flush_frame_bytes = 16384;
+
+	// Hard cap (in bytes) for all buffered lines, including those still being flushed.
+	// When reached, everything is written to disk synchronously.
+	// 0 - Disable hard cap.
+	int max_pending_bytes = 1048576;
+
+	// What to do when buffered lines reach `max_pending_bytes`.
+	// "block" - Write everything to disk synchronously.
+	// "drop_newest" - Drop incoming lines.
+	// "drop_oldest" - Drop oldest buffered lines.
+	// "drop_below" - Drop incoming lines below `overflow_level`, block for others.
+	string overflow_policy = "block";
+
+	// Minimum level that is never dropped with `drop_below` overflow policy.
+	// Values: `trace`, `debug`, `info`, `warn`, `error`, `fatal`, `off`.
+	// Invalid value is reported and replaced with `warn`.
+	string overflow_level = "warn";
+
 	// Maximum time in seconds to hold lines in the buffer before flushing.
 	// Prevents logs from being stuck in memory if the server is quiet.
 	int flush_interval = 5;
 
+	// Minimum level of a line that flushes the buffer to disk immediately.
+	// Keeps important events from being lost in memory on crash.
+	// Values: `trace`, `debug`, `info`, `warn`, `error`, `fatal`.
+	// `off` - Disable, lines flush only by buffer limits and `flush_interval`.
+	// Invalid value is reported and replaced with `warn`.
+	string flush_level = "warn";
+
 	[NonSerialized()]
 	string full_path;
 	[NonSerialized()]
 	string base_path;
+	[NonSerialized()]
+	int segment_seconds;
+	[NonSerialized()]
+	bool rotation_generations;
+	[NonSerialized()]
+	int generation = -1;
+	[NonSerialized()]
+	LogZ_SinkOverflow overflow_policy_enum;
+	[NonSerialized()]
+	LogZ_Level overflow_level_enum;
+	[NonSerialized()]
+	LogZ_Level flush_level_enum;
 
 	/**
 	    \brief Normalizes configuration values within valid ranges.
@@ -162,6 +264,151 @@ class LogZ_ConfigDTO_File
 	void Normalize()
 	{
 		rotation_keep = Math.Clamp(rotation_keep, 0, 100);
+		if (max_file_bytes > 0)
+			max_file_bytes = Math.Clamp(max_file_bytes, 1048576, int.MAX);
+		else
+			max_file_bytes = 0;
+
+
+		overflow_policy.TrimInPlace();
+		overflow_policy.ToLower();
+		switch (overflow_policy) {
+		case "drop_newest":
+			overflow_policy_enum = LogZ_SinkOverflow.DROP_NEWEST;
+			break;
+
+		case "drop_oldest":
+			overflow_policy_enum = LogZ_SinkOverflow.DROP_OLDEST;
+			break;
+
+		case "drop_below":
+			overflow_policy_enum = LogZ_SinkOverflow.DROP_BELOW;
+			break;
+
+		default:
+			overflow_policy_enum = LogZ_SinkOverflow.BLOCK;
+			break;
+		}
+
+		overflow_level_enum = ParseLevel(overflow_level, "overflow_level", "warn");
+		flush_level_enum = ParseLevel(flush_level, "flush_level", "warn");
+
+		segment.TrimInPlace();
+		segment.ToLower();
+		if (segment == "hour")
+			segment_seconds = 3600;
+		else if (segment == "day")
+			segment_seconds = 86400;
+		else
+			segment_seconds = 0;
+
+		// runtime size rotation must not copy files on the game thread
+		rotation_mode.TrimInPlace();
+		rotation_mode.ToLower();
+		rotation_generations = (rotation_mode == "generation" || (max_file_bytes > 0 && segment_seconds <= 0));
+
+		buffer_bytes = Math.Clamp(buffer_bytes, 0, 16777216);
+		flush_frame_bytes = Math.Clamp(flush_frame_bytes, 0, 16777216);
+		max_pending_bytes = Math.Clamp(max_pending_bytes, 0, 67108864);
+	}
+
+	/**
+	    \brief Parse level option strictly, invalid value is warned and replaced with fallback.
+	    \details Value is rewritten so next Normalize call does not warn again.
+	*/
+	protected static LogZ_Level ParseLevel(inout string value, string option, string fallback)
+	{
+		LogZ_Level lvl;
+		if (LogZ_Levels.TryFromString(value, lvl))
+			return lvl;
+
+		ErrorEx("LogZ: invalid " + option + " '" + value + "', using '" + fallback + "'", ErrorExSeverity.WARNING);
+		value = fallback;
+		LogZ_Levels.TryFromString(fallback, lvl);
+
+		return lvl;
+	}
+}
+
+class LogZ_ConfigDTO_Http
+{
+	// Base URL of NDJSON ingestion endpoint.
+	// "" - Disabled, logs are written only to `file`.
+	// Example: "http://127.0.0.1:9428" for VictoriaLogs.
+	string url;
+
+	// Request path appended to `url`, each flush of `file` buffer is sent as one POST body.
+	// Body is NDJSON, e.g. VictoriaLogs "/insert/jsonline?_stream_fields=instance,world&_msg_field=msg&_time_field=ts"
+	// or any collector HTTP input accepting NDJSON (Vector, Fluent Bit) in front of Loki.
+	string path = "/insert/jsonline";
+
+	// Content-Type header of requests.
+	string content_type = "application/x-ndjson";
+
+	// Also write logs to `file`.
+	// false - Only push over HTTP, no disk writes.
+	bool keep_file;
+
+	// Maximum number of concurrent POST requests.
+	// 1 - Strict line order. > 1 - Retried batches keep their order in the queue,
+	// but may reach the endpoint after newer batches that did not fail.
+	// On shutdown queued batches are sent as one final request.
+	int max_in_flight = 2;
+
+	// Maximum number of batches waiting to be sent, including failed ones kept for retry.
+	// Oldest batches are dropped when exceeded.
+	int max_queued_batches = 64;
+
+	// Delay in seconds before failed batches are sent again.
+	int retry_interval = 5;
+
+	/**
+	    \brief Normalizes configuration values within valid ranges.
+	*/
+	void Normalize()
+	{
+		url.TrimInPlace();
+		if (url.Length() > 0 && url.Substring(url.Length() - 1, 1) == "/")
+			url = url.Substring(0, url.Length() - 1);
+
+		path.TrimInPlace();
+		if (path != string.Empty && path.Substring(0, 1) != "/")
+			path = "/" + path;
+
+		max_in_flight = Math.Clamp(max_in_flight, 1, 16);
+		max_queued_batches = Math.Clamp(max_queued_batches, 1, 1024);
+		retry_interval = Math.Clamp(retry_interval, 1, 300);
+	}
+}
+
+class LogZ_ConfigDTO_Route
+{
+	// Route name, used in default file name `logz_${instance_id}_${name}.ndjson`.
+	string name;
+
+	// Events written to this route, same format as `settings.events_mask`.
+	// Events must also be enabled in `settings.events_mask`.
+	// Example: "HIJKLMNOPQ" for all hits and kills.
+	string events_mask;
+
+	// File output settings for this route, same options as `file`.
+	ref LogZ_ConfigDTO_File file;
+
+	[NonSerialized()]
+	int events_mask_int;
+
+	/**
+	    \brief Normalizes configuration values within valid ranges.
+	*/
+	void Normalize()
+	{
+		name.TrimInPlace();
+
+		if (!file)
+			file = new LogZ_ConfigDTO_File();
+
+		file.Normalize();
+		events_mask_int = LogZ_Helpers.ParseEventsMask(events_mask);
 	}
 }
 
@@ -226,9 +473,27 @@ class LogZ_ConfigDTO_Geo
 	// (For example, iZurvive tiles for Chernarus have a size of `15926`, although the world size is `15360`).
 	float world_effective_size;
 
+	// Digits after point of `pos` world coordinates, from `0` to `6`.
+	// `1` - decimetres, `-1` - full float precision (7 significant digits).
+	int precision = 1;
+
+	// Digits after point of `lon` and `lat`, from `0` to `6`.
+	// Game map is projected to the whole globe, `3` is about 4 cm on a 15 km map.
+	int lonlat_precision = 6;
+
+	// Position fields written for objects.
+	// Values: `all` - `pos` and `lon`/`lat`, `pos` - only world coordinates, `lonlat` - only `lon`/`lat`.
+	string output = "all";
+
 	[NonSerialized()]
 	float world_effective_size_resolved;
 
+	[NonSerialized()]
+	bool output_pos;
+
+	[NonSerialized()]
+	bool output_lonlat;
+
 	[NonSerialized()]
 	string world_name;
 
@@ -237,6 +502,17 @@ class LogZ_ConfigDTO_Geo
 	*/
 	void Normalize()
 	{
+		precision = Math.Clamp(precision, -1, LogZ_Json.FLOAT_MAX_DECIMALS);
+		lonlat_precision = Math.Clamp(lonlat_precision, 0, LogZ_Json.FLOAT_MAX_DECIMALS);
+
+		output.TrimInPlace();
+		output.ToLower();
+		if (output != "pos" && output != "lonlat")
+			output = "all";
+
+		output_pos = (output != "lonlat");
+		output_lonlat = (output != "pos");
+
 		if (!g_Game)
 			return;
 
@@ -252,4 +528,68 @@ class LogZ_ConfigDTO_Geo
 		}
 	}
 }
+
+class LogZ_ConfigDTO_Fields
+{
+	void LogZ_ConfigDTO_Fields()
+	{
+		player_stats = new array<string>();
+		entity_stats = new array<string>();
+		damage_zones = new array<string>();
+	}
+
+	// Fields of player `stats` object, empty - all fields.
+	// Example: `["blood_type", "bleeding_bits", "water", "energy", "playtime"]`.
+	ref array<string> player_stats;
+
+	// Stats fields of items and other entities, empty - all fields.
+	// Values: `quantity`, `wet`, `temperature`, `liquid`, `clean`, `agent`, `em`, `em_on`.
+	ref array<string> entity_stats;
+
+	// Write `zones` object with health of damage zones for players and vehicles.
+	bool zones = true;
+
+	// Damage zones written in `zones`, empty - all zones of object.
+	// Example: `["Head", "Torso", "Engine", "FuelTank"]`.
+	ref array<string> damage_zones;
+
+	[NonSerialized()]
+	int player_stats_mask = LogZ_PlayerStatsField.ALL;
+
+	[NonSerialized()]
+	int entity_stats_mask = LogZ_EntityStatsField.ALL;
+
+	[NonSerialized()]
+	ref map<string, bool> damage_zones_set;
+
+	// Field lists are parsed once per loaded config, unknown names are warned once
+	[NonSerialized()]
+	bool parsed;
+
+	/**
+	    \brief Normalizes configuration values within valid ranges.
+	    \details Parses field lists only on first call, config is normalized on load and again on SetLoaded.
+	*/
+	void Normalize()
+	{
+		if (parsed)
+			return;
+
+		parsed = true;
+
+		player_stats_mask = LogZ_Fields.ParseMask(player_stats, LogZ_Fields.PLAYER_STATS, "fields.player_stats");
+		entity_stats_mask = LogZ_Fields.ParseMask(entity_stats, LogZ_Fields.ENTITY_STATS, "fields.entity_stats");
+
+		damage_zones_set = null;
+		if (!damage_zones || damage_zones.Count() == 0)
+			return;
+
+		damage_zones_set = new map<string, bool>();
+		foreach (string zone : damage_zones) {
+			zone.TrimInPlace();
+			if (zone != string.Empty)
+				damage_zones_set.Set(zone, true);
+		}
+	}
+}
 #endif
@@ -55,5 +55,26 @@ class LogZ_Helpers
 
 		return "0";
 	}
+
+	/**
+	    \brief Parse events mask from letters or integer literal.
+	    \return int Bit mask of built-in and custom events, -1 means all events.
+	*/
+	static int ParseEventsMask(string mask)
+	{
+		int maskInt;
+		if (LogZ_Utils.HasAlpha(mask))
+			maskInt = LogZ_Events.FromString(mask);
+		else
+			maskInt = mask.ToInt();
+
+		if (maskInt == -1)
+			return LogZ_Event.MAX | LogZ_Events.CUSTOM_MASK;
+
+		if (maskInt <= LogZ_Event.NONE)
+			return LogZ_Event.NONE;
+
+		return maskInt & (LogZ_Event.MAX | LogZ_Events.CUSTOM_MASK);
+	}
 }
 #endif
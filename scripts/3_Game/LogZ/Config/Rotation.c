@@ -0,0 +1,180 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/logz
+*/
+
+#ifdef SERVER
+/**
+    \brief Log files rotation helpers.
+    \details Shared by startup rotation in LogZ_Config and size-based rotation in LogZ_Sink.
+*/
+class LogZ_Rotation
+{
+	/**
+	    \brief Rotates log files by configured rotation_mode.
+	    \details "shift" renames by copy .N -> .N+1, "generation" only opens next
+	             generation file and deletes the oldest one.
+	    \param cfg  File config with resolved base_path and full_path.
+	    \param keep Number of rotated files to keep.
+	*/
+	static void Rotate(LogZ_ConfigDTO_File cfg, int keep)
+	{
+		if (!cfg || keep < 1)
+			return;
+
+		if (cfg.rotation_generations) {
+			NextGeneration(cfg, keep);
+			return;
+		}
+
+		string ext = LogZ_Constants.LOG_EXT;
+
+		// delete last
+		string last = string.Format("%1.%2%3", cfg.base_path, keep - 1, ext);
+		if (FileExist(last))
+			DeleteFile(last);
+
+		// shift .N-1 -> .N, ..., .0 -> .1, base -> .0
+		for (int i = keep - 2; i >= -1; i--) {
+			string srcLog = cfg.full_path;
+			if (i >= 0)
+				srcLog = string.Format("%1.%2%3", cfg.base_path, i, ext);
+
+			string dstLog = string.Format("%1.%2%3", cfg.base_path, i + 1, ext);
+
+			if (FileExist(srcLog)) {
+				CopyFile(srcLog, dstLog);
+				DeleteFile(srcLog);
+			}
+		}
+	}
+
+	/**
+	    \brief Switch full_path to next "<base>.<N>.ndjson" generation without copying data.
+	    \details First call scans existing generations, later calls only delete the
+	             generation falling out of the keep window.
+	    \param cfg  File config with resolved base_path.
+	    \param keep Number of previous generations to keep.
+	*/
+	static void NextGeneration(LogZ_ConfigDTO_File cfg, int keep)
+	{
+		string ext = LogZ_Constants.LOG_EXT;
+
+		if (cfg.generation < 0) {
+			array<string> paths = new array<string>();
+			array<int> numbers = new array<int>();
+			FindNumbered(cfg, ".", paths, numbers);
+
+			foreach (int n : numbers) {
+				if (n > cfg.generation)
+					cfg.generation = n;
+			}
+
+			cfg.generation++;
+
+			for (int i = 0; i < numbers.Count(); ++i) {
+				if (numbers[i] < cfg.generation - keep)
+					DeleteFile(paths[i]);
+			}
+		} else {
+			cfg.generation++;
+
+			string expired = string.Format("%1.%2%3", cfg.base_path, cfg.generation - keep - 1, ext);
+			if (FileExist(expired))
+				DeleteFile(expired);
+		}
+
+		cfg.full_path = string.Format("%1.%2%3", cfg.base_path, cfg.generation, ext);
+	}
+
+	/**
+	    \brief Path of time-windowed segment for given time.
+	    \details "<base>_YYYYMMDDHH.ndjson" for hourly and "<base>_YYYYMMDD.ndjson" for daily segments.
+	*/
+	static string SegmentPath(LogZ_ConfigDTO_File cfg, int epoch)
+	{
+		return string.Format("%1_%2%3", cfg.base_path, SegmentStamp(cfg, epoch), LogZ_Constants.LOG_EXT);
+	}
+
+	/**
+	    \brief Delete segments older than rotation_keep windows before the current one.
+	    \details Only segments of the current window size are pruned, files left after
+	             switching between "hour" and "day" are never deleted.
+	    \param cfg   File config with resolved base_path and segment_seconds.
+	    \param epoch Current epoch seconds.
+	*/
+	static void PruneSegments(LogZ_ConfigDTO_File cfg, int epoch)
+	{
+		if (!cfg || cfg.segment_seconds <= 0 || cfg.rotation_keep < 1)
+			return;
+
+		string cutoffStamp = SegmentStamp(cfg, epoch - cfg.rotation_keep * cfg.segment_seconds);
+		int cutoff = cutoffStamp.ToInt();
+		int stampLength = cutoffStamp.Length();
+
+		array<string> paths = new array<string>();
+		array<int> stamps = new array<int>();
+		FindNumbered(cfg, "_", paths, stamps);
+
+		for (int i = 0; i < stamps.Count(); ++i) {
+			// segments of other window (hour vs day) are left as is
+			if (stamps[i].ToString().Length() != stampLength)
+				continue;
+
+			if (stamps[i] < cutoff)
+				DeleteFile(paths[i]);
+		}
+	}
+
+	/**
+	    \brief Segment stamp for given time by configured window.
+	*/
+	protected static string SegmentStamp(LogZ_ConfigDTO_File cfg, int epoch)
+	{
+		return LogZ_Time.DateStamp(epoch, cfg.segment_seconds < 86400);
+	}
+
+	/**
+	    \brief Find "<base><sep><digits>.ndjson" files.
+	    \param cfg          File config with resolved base_path.
+	    \param sep          Separator between base name and number.
+	    \param[out] paths   Full paths of found files.
+	    \param[out] numbers Parsed numbers, same order as paths.
+	*/
+	protected static void FindNumbered(LogZ_ConfigDTO_File cfg, string sep, array<string> paths, array<int> numbers)
+	{
+		// split "$profile:logz/logs/logz_1" into directory and file prefix
+		int slash = cfg.base_path.LastIndexOf("/");
+		if (slash < 0)
+			slash = cfg.base_path.LastIndexOf(":");
+
+		string dir = cfg.base_path.Substring(0, slash + 1);
+		string prefix = cfg.base_path.Substring(slash + 1, cfg.base_path.Length() - slash - 1) + sep;
+		string ext = LogZ_Constants.LOG_EXT;
+
+		string fileName;
+		FileAttr fileAttr;
+
+		FindFileHandle handle = FindFile(dir + prefix + "*" + ext, fileName, fileAttr, FindFileFlags.ALL);
+		if (!handle)
+			return;
+
+		bool found = true;
+		while (found) {
+			int numLen = fileName.Length() - prefix.Length() - ext.Length();
+			if (numLen > 0) {
+				string num = fileName.Substring(prefix.Length(), numLen);
+				if (LogZ_Utils.IsDigitsOnly(num)) {
+					paths.Insert(dir + fileName);
+					numbers.Insert(num.ToInt());
+				}
+			}
+
+			found = FindNextFile(handle, fileName, fileAttr);
+		}
+
+		CloseFindFile(handle);
+	}
+}
+#endif
@@ -0,0 +1,50 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/logz
+*/
+
+#ifdef SERVER
+/**
+    \brief Base of all LogZ DTOs written with LogZ_JsonWriter.
+    \details Derived classes override WriteFields, call super first
+             to keep fields order of base classes.
+             DTOs can be reused for many lines, Reset clears all fields
+             before the next fill, derived classes call super too.
+*/
+class LogZ_DTO_Base
+{
+	/**
+	    \brief Write DTO as JSON object.
+	    \param writer Target writer.
+	    \param key    Object key, empty for array element or root object.
+	*/
+	void Write(LogZ_JsonWriter writer, string key = string.Empty)
+	{
+		writer.BeginObject(key);
+		WriteFields(writer);
+		writer.EndObject();
+	}
+
+	/**
+	    \brief Clear all fields for reuse.
+	*/
+	void Reset() {}
+
+	/**
+	    \brief Write DTO fields into current object.
+	*/
+	void WriteFields(LogZ_JsonWriter writer) {}
+
+	/**
+	    \brief Serialize DTO to standalone JSON object string.
+	*/
+	string ToJson()
+	{
+		LogZ_JsonWriter writer = new LogZ_JsonWriter();
+		Write(writer);
+
+		return writer.GetJson();
+	}
+}
+#endif
@@ -8,7 +8,7 @@
 /**
     \brief Serializable damage snapshot for hit/kill events.
 */
-class LogZ_DTO_Damage
+class LogZ_DTO_Damage : LogZ_DTO_Base
 {
 	float damage;
 	string damage_zone;
@@ -19,6 +19,14 @@ class LogZ_DTO_Damage
 	    \brief Construct DTO from TotalDamageResult, type and zone.
 	*/
 	void LogZ_DTO_Damage(TotalDamageResult damageResult, int damageType, string dmgZone, string ammo)
+	{
+		Load(damageResult, damageType, dmgZone, ammo);
+	}
+
+	/**
+	    \brief Populate all fields from TotalDamageResult, type and zone, used to reuse DTO.
+	*/
+	void Load(TotalDamageResult damageResult, int damageType, string dmgZone, string ammo)
 	{
 		if (damageResult)
 			damage = damageResult.GetDamage(dmgZone, "");
@@ -29,5 +37,13 @@ class LogZ_DTO_Damage
 		damage_type = EnumTools.EnumToString(DamageType, damageType);
 		ammo_type = ammo;
 	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		writer.AddFloat("damage", damage);
+		writer.OptRawString("damage_zone", damage_zone);
+		writer.AddRawString("damage_type", damage_type);
+		writer.OptRawString("ammo_type", ammo_type);
+	}
 }
 #endif
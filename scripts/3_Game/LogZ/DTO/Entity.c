@@ -13,6 +13,21 @@ class LogZ_DTO_Entity : LogZ_DTO_Object_Base
 	int id;
 	float lifetime;
 
+	override void Reset()
+	{
+		super.Reset();
+
+		id = 0;
+		lifetime = 0;
+	}
+
+	override void Load(Object obj)
+	{
+		Reset();
+		Fill(obj);
+		FillEntity(obj);
+	}
+
 	/**
 	    \brief Populate EntityAI-specific fields.
 	*/
@@ -34,6 +49,14 @@ class LogZ_DTO_Entity : LogZ_DTO_Object_Base
 		Fill(obj);
 		FillEntity(obj);
 	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		super.WriteFields(writer);
+
+		writer.AddInt("id", id);
+		writer.OptFloat("lifetime", lifetime);
+	}
 }
 
 /**
@@ -50,8 +73,34 @@ class LogZ_DTO_EntityStats : LogZ_DTO_Entity
 	float em;
 	bool em_on;
 
+	// LogZ_EntityStatsField bits of filled fields
+	protected int m_Mask;
+
+	override void Reset()
+	{
+		super.Reset();
+
+		quantity = 0;
+		wet = 0;
+		temperature = 0;
+		liquid = 0;
+		clean = 0;
+		agent = 0;
+		em = 0;
+		em_on = false;
+		m_Mask = 0;
+	}
+
+	override void Load(Object obj)
+	{
+		Reset();
+		Fill(obj);
+		FillEntity(obj);
+		FillEntityStats(obj);
+	}
+
 	/**
-	    \brief Populate EntityAI stats if object is EntityAI.
+	    \brief Populate EntityAI stats enabled in `fields.entity_stats` if object is EntityAI.
 	*/
 	void FillEntityStats(Object obj)
 	{
@@ -59,19 +108,32 @@ class LogZ_DTO_EntityStats : LogZ_DTO_Entity
 		if (!Class.CastTo(eai, obj))
 			return;
 
-		int capacity = eai.GetQuantityMax() - eai.GetQuantityMin();
-		if (capacity > 0)
-			quantity = eai.GetQuantity() / capacity;
-		else
-			quantity = 0;
+		m_Mask = LogZ_Config.Get().fields.entity_stats_mask;
+
+		if (m_Mask & LogZ_EntityStatsField.QUANTITY) {
+			int capacity = eai.GetQuantityMax() - eai.GetQuantityMin();
+			if (capacity > 0)
+				quantity = eai.GetQuantity() / capacity;
+			else
+				quantity = 0;
+		}
+
+		if (m_Mask & LogZ_EntityStatsField.WET)
+			wet = eai.GetWet();
+
+		if (m_Mask & LogZ_EntityStatsField.TEMPERATURE)
+			temperature = eai.GetTemperature();
+
+		if (m_Mask & LogZ_EntityStatsField.LIQUID)
+			liquid = eai.GetLiquidType();
 
-		wet = eai.GetWet();
-		temperature = eai.GetTemperature();
-		liquid = eai.GetLiquidType();
-		clean = eai.GetCleanness();
-		agent = eai.GetAgents();
+		if (m_Mask & LogZ_EntityStatsField.CLEAN)
+			clean = eai.GetCleanness();
 
-		if (eai.HasEnergyManager()) {
+		if (m_Mask & LogZ_EntityStatsField.AGENT)
+			agent = eai.GetAgents();
+
+		if ((m_Mask & (LogZ_EntityStatsField.EM | LogZ_EntityStatsField.EM_ON)) && eai.HasEnergyManager()) {
 			em = eai.GetCompEM().GetEnergy();
 			em_on = eai.GetCompEM().IsSwitchedOn();
 		}
@@ -86,5 +148,34 @@ class LogZ_DTO_EntityStats : LogZ_DTO_Entity
 		FillEntity(obj);
 		FillEntityStats(obj);
 	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		super.WriteFields(writer);
+
+		if (m_Mask & LogZ_EntityStatsField.QUANTITY)
+			writer.OptFloat("quantity", quantity);
+
+		if (m_Mask & LogZ_EntityStatsField.WET)
+			writer.OptFloat("wet", wet);
+
+		if (m_Mask & LogZ_EntityStatsField.TEMPERATURE)
+			writer.OptFloat("temperature", temperature);
+
+		if (m_Mask & LogZ_EntityStatsField.LIQUID)
+			writer.OptInt("liquid", liquid);
+
+		if (m_Mask & LogZ_EntityStatsField.CLEAN)
+			writer.OptInt("clean", clean);
+
+		if (m_Mask & LogZ_EntityStatsField.AGENT)
+			writer.OptInt("agent", agent);
+
+		if (m_Mask & LogZ_EntityStatsField.EM)
+			writer.OptFloat("em", em);
+
+		if (m_Mask & LogZ_EntityStatsField.EM_ON)
+			writer.OptBool("em_on", em_on);
+	}
 }
 #endif
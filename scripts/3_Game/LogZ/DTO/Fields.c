@@ -0,0 +1,106 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/logz
+*/
+
+#ifdef SERVER
+/**
+    \brief Bits of optional fields of player `stats` object.
+*/
+enum LogZ_PlayerStatsField {
+	BLOOD_TYPE = 1,
+	BLOOD_TYPE_VISIBLE = 2,
+	BLEEDING_BITS = 4,
+	BLOOD_HANDS = 8,
+	AGENTS = 16,
+	LIFE_SPAN = 32,
+	BROKEN_LEG = 64,
+	LAST_SHAVED = 128,
+	IMMUNITY_BOOST = 256,
+	UNCONSCIOUS = 512,
+	RESTRAINED = 1024,
+	THIRD_PERSON = 2048,
+	WATER = 4096,
+	TOXICITY = 8192,
+	ENERGY = 16384,
+	HEAT_COMFORT = 32768,
+	TREMOR = 65536,
+	DIET = 131072,
+	STAMINA = 262144,
+	SPECIALTY = 524288,
+	HEAT_BUFFER = 1048576,
+	PLAYTIME = 2097152,
+	DISTANCE = 4194304,
+	LONGEST_SURVIVOR_HIT = 8388608,
+	PLAYERS_KILLED = 16777216,
+	INFECTED_KILLED = 33554432,
+
+	ALL = 67108863
+}
+
+/**
+    \brief Bits of optional fields of entity stats.
+*/
+enum LogZ_EntityStatsField {
+	QUANTITY = 1,
+	WET = 2,
+	TEMPERATURE = 4,
+	LIQUID = 8,
+	CLEAN = 16,
+	AGENT = 32,
+	EM = 64,
+	EM_ON = 128,
+
+	ALL = 255
+}
+
+/**
+    \brief Field names of optional DTO fields configured in `fields` config block.
+*/
+class LogZ_Fields
+{
+	// Names of LogZ_PlayerStatsField bits, index is bit number
+	static const ref array<string> PLAYER_STATS = {
+		"blood_type", "blood_type_visible", "bleeding_bits", "blood_hands", "agents", "life_span",
+		"broken_leg", "last_shaved", "immunity_boost", "unconscious", "restrained", "third_person",
+		"water", "toxicity", "energy", "heat_comfort", "tremor", "diet", "stamina", "specialty",
+		"heat_buffer", "playtime", "distance", "longest_survivor_hit", "players_killed",
+		"infected_killed"
+	};
+
+	// Names of LogZ_EntityStatsField bits, index is bit number
+	static const ref array<string> ENTITY_STATS = {
+		"quantity", "wet", "temperature", "liquid", "clean", "agent", "em", "em_on"
+	};
+
+	/**
+	    \brief Parse list of field names to bit mask.
+	    \param fields Enabled field names, empty or null list enables all fields.
+	    \param names  Known field names, index is bit number.
+	    \param option Config option name for warnings.
+	    \return int Bit mask of enabled fields.
+	*/
+	static int ParseMask(array<string> fields, array<string> names, string option)
+	{
+		if (!fields || fields.Count() == 0)
+			return (1 << names.Count()) - 1;
+
+		int mask;
+		foreach (string field : fields) {
+			field.TrimInPlace();
+			field.ToLower();
+
+			int bit = names.Find(field);
+			if (bit < 0) {
+				ErrorEx("LogZ: unknown field '" + field + "' in " + option, ErrorExSeverity.WARNING);
+				continue;
+			}
+
+			mask |= 1 << bit;
+		}
+
+		return mask;
+	}
+}
+#endif
@@ -16,6 +16,24 @@ class LogZ_DTO_Man : LogZ_DTO_Object
 	string player_name;
 	string steam_id;
 
+	override void Reset()
+	{
+		super.Reset();
+
+		blood = 0;
+		shock = 0;
+		id = 0;
+		player_name = string.Empty;
+		steam_id = string.Empty;
+	}
+
+	override void Load(Object obj)
+	{
+		Reset();
+		Fill(obj);
+		FillMan(obj);
+	}
+
 	/**
 	    \brief Populate Man-specific fields.
 	*/
@@ -48,6 +66,17 @@ class LogZ_DTO_Man : LogZ_DTO_Object
 		Fill(obj);
 		FillMan(obj);
 	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		super.WriteFields(writer);
+
+		writer.AddFloat("blood", blood);
+		writer.AddFloat("shock", shock);
+		writer.AddInt("id", id);
+		writer.OptString("player_name", player_name);
+		writer.OptString("steam_id", steam_id);
+	}
 }
 
 /**
@@ -61,6 +90,25 @@ class LogZ_DTO_ManStats : LogZ_DTO_ObjectStats
 	string player_name;
 	string steam_id;
 
+	override void Reset()
+	{
+		super.Reset();
+
+		blood = 0;
+		shock = 0;
+		id = 0;
+		player_name = string.Empty;
+		steam_id = string.Empty;
+	}
+
+	override void Load(Object obj)
+	{
+		Reset();
+		Fill(obj);
+		FillStats(obj);
+		FillMan(obj);
+	}
+
 	/**
 	    \brief Populate Man-specific fields.
 	*/
@@ -91,5 +139,16 @@ class LogZ_DTO_ManStats : LogZ_DTO_ObjectStats
 		FillStats(obj);
 		FillMan(obj);
 	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		super.WriteFields(writer);
+
+		writer.AddFloat("blood", blood);
+		writer.AddFloat("shock", shock);
+		writer.AddInt("id", id);
+		writer.OptString("player_name", player_name);
+		writer.OptString("steam_id", steam_id);
+	}
 }
 #endif
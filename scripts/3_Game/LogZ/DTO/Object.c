@@ -8,7 +8,7 @@
 /**
     \brief Common subset of object data for logging.
 */
-class LogZ_DTO_Object_Base
+class LogZ_DTO_Object_Base : LogZ_DTO_Base
 {
 	string name;
 	string type;
@@ -18,6 +18,26 @@ class LogZ_DTO_Object_Base
 	float lat;
 	float health;
 
+	override void Reset()
+	{
+		name = string.Empty;
+		type = string.Empty;
+		yaw = 0;
+		pos = vector.Zero;
+		lon = 0;
+		lat = 0;
+		health = 0;
+	}
+
+	/**
+	    \brief Reset and populate all fields from object, used to reuse DTO.
+	*/
+	void Load(Object obj)
+	{
+		Reset();
+		Fill(obj);
+	}
+
 	/**
 	    \brief Populate object fields from Object if non-null.
 	*/
@@ -30,9 +50,29 @@ class LogZ_DTO_Object_Base
 		type = LogZ_Object.GetType(obj);
 		yaw = Math.Round(obj.GetOrientation()[0]);
 		pos = obj.GetPosition();
-		LogZ_Geo.GetLonLat(pos, lon, lat);
+		if (LogZ_Geo.WithLonLat())
+			LogZ_Geo.GetLonLat(pos, lon, lat);
+
 		health = obj.GetHealth01("", "Health");
 	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		writer.AddString("name", name);
+		writer.AddRawString("type", type);
+		writer.AddInt("yaw", yaw);
+
+		if (LogZ_Geo.WithPos())
+			writer.AddVector("pos", pos, LogZ_Geo.GetPosDecimals());
+
+		if (LogZ_Geo.WithLonLat()) {
+			int decimals = LogZ_Geo.GetLonLatDecimals();
+			writer.AddFloat("lon", lon, decimals);
+			writer.AddFloat("lat", lat, decimals);
+		}
+
+		writer.AddFloat("health", health);
+	}
 }
 
 /**
@@ -57,6 +97,25 @@ class LogZ_DTO_ObjectStats : LogZ_DTO_Object_Base
 	bool allow_damage;
 	ref map<string, float> zones;
 
+	// zones map kept between Reset calls
+	protected ref map<string, float> m_Zones;
+	protected static ref array<string> s_DamageZones = new array<string>();
+
+	override void Reset()
+	{
+		super.Reset();
+
+		allow_damage = false;
+		zones = null;
+	}
+
+	override void Load(Object obj)
+	{
+		Reset();
+		Fill(obj);
+		FillStats(obj);
+	}
+
 	/**
 	    \brief Populate damage-related stats from Object.
 	*/
@@ -67,12 +126,43 @@ class LogZ_DTO_ObjectStats : LogZ_DTO_Object_Base
 
 		allow_damage = obj.GetAllowDamage();
 
-		zones = new map<string, float>();
-		array<string> damageZones = new array<string>();
-		obj.GetDamageZones(damageZones);
+		LogZ_ConfigDTO_Fields cfg = LogZ_Config.Get().fields;
+		if (!cfg.zones)
+			return;
+
+		if (!m_Zones)
+			m_Zones = new map<string, float>();
+		else
+			m_Zones.Clear();
+
+		zones = m_Zones;
+
+		s_DamageZones.Clear();
+		obj.GetDamageZones(s_DamageZones);
+
+		map<string, bool> allowed = cfg.damage_zones_set;
+		foreach (string dz : s_DamageZones) {
+			if (allowed && !allowed.Contains(dz))
+				continue;
 
-		foreach (string dz : damageZones)
 			zones.Insert(dz, obj.GetHealth01(dz, "Health"));
+		}
+	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		super.WriteFields(writer);
+
+		writer.AddBool("allow_damage", allow_damage);
+
+		if (!zones)
+			return;
+
+		writer.BeginObject("zones");
+		foreach (string dz, float zoneHealth : zones)
+			writer.AddFloat(LogZ_Json.Escape(dz), zoneHealth);
+
+		writer.EndObject();
 	}
 
 	/**
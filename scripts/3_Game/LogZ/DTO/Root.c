@@ -7,16 +7,21 @@
 #ifdef SERVER
 /**
     \brief Root log record envelope.
+    \details Fields constant after config load ("instance", "level", "schema", "world")
+             are written from pre-escaped fragment built once per level by BuildEnvelope.
 */
-class LogZ_DTO_Root
+class LogZ_DTO_Root : LogZ_DTO_Base
 {
+	// cached static fields fragment, indexed by LogZ_Level
+	protected static ref array<string> s_Envelope = new array<string>();
+	// write "ts_ms" field (settings.timestamp_ms)
+	protected static bool s_WithMillis;
+
 	int ts; // UTC time (epoch seconds)
+	string ts_ms; // UTC time (epoch milliseconds), JSON integer literal, empty if disabled
 	int uptime_ms; // server uptime (ms)
 	int world_time; // game world time (epoch seconds)
-	string instance; // instance id (or GamePort or QueryPort as fallback)
-	string level; // LogZ_Levels level
-	string schema; // LogZ schema version
-	string world; // game world name
+	LogZ_Level level; // LogZ_Levels level, written with cached instance, schema and world
 	string event_type; // LogZ_Events type
 	string msg;
 
@@ -24,23 +29,75 @@ class LogZ_DTO_Root
 	    \brief Construct envelope from level, message and event type.
 	*/
 	void LogZ_DTO_Root(LogZ_Level lvl, string message, LogZ_Event eventType)
+	{
+		Load(lvl, message, eventType);
+	}
+
+	/**
+	    \brief Populate all fields for next line, used to reuse DTO.
+	*/
+	void Load(LogZ_Level lvl, string message, LogZ_Event eventType)
 	{
 		if (!LogZ_Config.IsLoaded())
 			return;
 
-		LogZ_ConfigDTO cfg = LogZ_Config.Get();
-		if (!cfg)
-			return;
+		ts = LogZ_Time.ClockEpochSecondsUTC();
+		if (s_WithMillis)
+			ts_ms = LogZ_Time.ClockEpochMillisUTC();
+		else
+			ts_ms = string.Empty;
 
-		ts = LogZ_Time.EpochSecondsUTC();
 		uptime_ms = g_Game.GetTime();
-		world_time = LogZ_Time.GameEpochSeconds();
-		instance = cfg.settings.instance_id_resolved;
-		level = LogZ_Levels.ToString(lvl);
-		schema = LogZ_Constants.SCHEMA_VERSION;
-		world = cfg.geo.world_name;
+		world_time = LogZ_Time.ClockGameEpochSeconds();
+		level = lvl;
 		event_type = LogZ_Events.ToString(eventType);
 		msg = message;
 	}
+
+	/**
+	    \brief Build static envelope fields fragment for every level.
+	    \details Called from LogZ_Config on (re)load, values never change between loads:
+	             "instance" (instance id or GamePort or QueryPort as fallback),
+	             "level", "schema" (LogZ schema version) and "world" (game world name).
+	*/
+	static void BuildEnvelope()
+	{
+		s_Envelope.Clear();
+
+		LogZ_ConfigDTO cfg = LogZ_Config.Get();
+		if (!cfg)
+			return;
+
+		s_WithMillis = cfg.settings.timestamp_ms;
+		if (s_WithMillis)
+			LogZ_Time.StartClockCalibration();
+
+		LogZ_JsonWriter writer = new LogZ_JsonWriter();
+		for (int lvl = LogZ_Level.TRACE; lvl <= LogZ_Level.OFF; lvl++) {
+			writer.Reset();
+			writer.AddString("instance", cfg.settings.instance_id_resolved);
+			writer.AddString("level", LogZ_Levels.ToString(lvl));
+			writer.AddString("schema", LogZ_Constants.SCHEMA_VERSION);
+			writer.AddString("world", cfg.geo.world_name);
+			s_Envelope.Insert(writer.GetJson());
+		}
+	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		writer.AddInt("ts", ts);
+
+		if (ts_ms != string.Empty)
+			writer.AddRaw("ts_ms", ts_ms);
+
+		writer.AddInt("uptime_ms", uptime_ms);
+		writer.AddInt("world_time", world_time);
+
+		if (level >= 0 && level < s_Envelope.Count())
+			writer.AddFields(s_Envelope[level]);
+
+		writer.AddRawString("event_type", event_type);
+		writer.AddString("msg", msg);
+	}
 }
 #endif
@@ -13,8 +13,29 @@ class LogZ_DTO_Transport : LogZ_DTO_Object
 	int id;
 	float lifetime;
 	float speed;
+	// crew DTOs kept between Reset calls, only first m_MemberCount are live
 	ref array<ref LogZ_DTO_Man> members;
 
+	// live crew count, -1 when crew was not filled
+	protected int m_MemberCount = -1;
+
+	override void Reset()
+	{
+		super.Reset();
+
+		id = 0;
+		lifetime = 0;
+		speed = 0;
+		m_MemberCount = -1;
+	}
+
+	override void Load(Object obj)
+	{
+		Reset();
+		Fill(obj);
+		FillTransport(obj);
+	}
+
 	/**
 	    \brief Populate transport-specific fields and crew.
 	*/
@@ -28,13 +49,25 @@ class LogZ_DTO_Transport : LogZ_DTO_Object
 		lifetime = veh.GetLifetime();
 		speed = GetVelocity(veh).Length();
 
-		members = new array<ref LogZ_DTO_Man>();
+		if (!members)
+			members = new array<ref LogZ_DTO_Man>();
+
+		int count;
 		int crewSize = veh.CrewSize();
 		for (int i = 0; i < crewSize; ++i) {
 			Man man = veh.CrewMember(i);
-			if (man)
+			if (!man)
+				continue;
+
+			if (count < members.Count())
+				members[count].Load(man);
+			else
 				members.Insert(new LogZ_DTO_Man(man));
+
+			count++;
 		}
+
+		m_MemberCount = count;
 	}
 
 	/**
@@ -45,6 +78,24 @@ class LogZ_DTO_Transport : LogZ_DTO_Object
 		Fill(obj);
 		FillTransport(obj);
 	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		super.WriteFields(writer);
+
+		writer.AddInt("id", id);
+		writer.OptFloat("lifetime", lifetime);
+		writer.OptFloat("speed", speed);
+
+		if (m_MemberCount < 0)
+			return;
+
+		writer.BeginArray("members");
+		for (int i = 0; i < m_MemberCount; ++i)
+			members[i].Write(writer);
+
+		writer.EndArray();
+	}
 }
 
 /**
@@ -55,8 +106,30 @@ class LogZ_DTO_TransportStats : LogZ_DTO_ObjectStats
 	int id;
 	float lifetime;
 	float speed;
+	// crew DTOs kept between Reset calls, only first m_MemberCount are live
 	ref array<ref LogZ_DTO_ManStats> members;
 
+	// live crew count, -1 when crew was not filled
+	protected int m_MemberCount = -1;
+
+	override void Reset()
+	{
+		super.Reset();
+
+		id = 0;
+		lifetime = 0;
+		speed = 0;
+		m_MemberCount = -1;
+	}
+
+	override void Load(Object obj)
+	{
+		Reset();
+		Fill(obj);
+		FillStats(obj);
+		FillTransport(obj);
+	}
+
 	/**
 	    \brief Populate transport stats and crew stats.
 	*/
@@ -70,13 +143,25 @@ class LogZ_DTO_TransportStats : LogZ_DTO_ObjectStats
 		lifetime = veh.GetLifetime();
 		speed = GetVelocity(veh).Length();
 
-		members = new array<ref LogZ_DTO_ManStats>();
+		if (!members)
+			members = new array<ref LogZ_DTO_ManStats>();
+
+		int count;
 		int crewSize = veh.CrewSize();
 		for (int i = 0; i < crewSize; ++i) {
 			Man man = veh.CrewMember(i);
-			if (man)
+			if (!man)
+				continue;
+
+			if (count < members.Count())
+				members[count].Load(man);
+			else
 				members.Insert(new LogZ_DTO_ManStats(man));
+
+			count++;
 		}
+
+		m_MemberCount = count;
 	}
 
 	/**
@@ -88,5 +173,23 @@ class LogZ_DTO_TransportStats : LogZ_DTO_ObjectStats
 		FillStats(obj);
 		FillTransport(obj);
 	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		super.WriteFields(writer);
+
+		writer.AddInt("id", id);
+		writer.OptFloat("lifetime", lifetime);
+		writer.OptFloat("speed", speed);
+
+		if (m_MemberCount < 0)
+			return;
+
+		writer.BeginArray("members");
+		for (int i = 0; i < m_MemberCount; ++i)
+			members[i].Write(writer);
+
+		writer.EndArray();
+	}
 }
 #endif
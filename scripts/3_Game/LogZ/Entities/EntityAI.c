@@ -0,0 +1,37 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/logz
+*/
+
+#ifdef SERVER
+modded class EntityAI
+{
+	protected int m_LogZ_Id;
+	protected bool m_LogZ_IdPersistent; // m_LogZ_Id is derived from persistent id
+
+	/**
+	    \brief LogZ id kept for entity lifetime once derived from persistent id.
+	    \details Hash of persistent id, or random per runtime id for non-persistent
+	             entities (zombies, animals), so all lines of one entity share the same id.
+	             Random id of entity logged before it got persistent id (e.g. during creation)
+	             is replaced by persistent one as soon as it is assigned.
+	*/
+	int LogZ_GetId()
+	{
+		if (m_LogZ_IdPersistent)
+			return m_LogZ_Id;
+
+		int p1, p2, p3, p4;
+		GetPersistentID(p1, p2, p3, p4);
+		if (p1 != 0 || p2 != 0 || p3 != 0 || p4 != 0) {
+			m_LogZ_Id = LogZ_Object.ComputePersistentHash(this);
+			m_LogZ_IdPersistent = true;
+		} else if (m_LogZ_Id == 0) {
+			m_LogZ_Id = LogZ_Object.ComputePersistentHash(this);
+		}
+
+		return m_LogZ_Id;
+	}
+}
+#endif
@@ -77,12 +77,24 @@ class LogZ_Events
 	// damage mask (hit or kill)
 	static const int DAMAGE_MASK = HIT_MASK | KILL_MASK;
 
+	// bits free for event types registered by other mods (1 << 26 .. 1 << 30)
+	static const int CUSTOM_MASK = 2080374784;
+
+	// number of event bits, built-in and custom
+	static const int BITS = 31;
+
+	// event names indexed by bit position, empty for unregistered custom bits
+	protected static ref array<string> s_Names;
+
 	/**
 	    \brief Check if event type is enabled by current config bitmask.
 	*/
 	static bool IsEnabled(LogZ_Event eventType)
 	{
-		if (eventType <= LogZ_Event.NONE || eventType >= LogZ_Event.MAX)
+		if (eventType <= LogZ_Event.NONE)
+			return false;
+
+		if (eventType >= LogZ_Event.MAX && !IsRegistered(eventType))
 			return false;
 
 		if (!LogZ_Config.IsLoaded())
@@ -96,14 +108,95 @@ class LogZ_Events
 	*/
 	static string ToString(LogZ_Event eventType)
 	{
-		if (eventType <= LogZ_Event.NONE || eventType >= LogZ_Event.MAX)
+		int bit = BitIndex(eventType);
+		if (bit < 0)
 			return "none";
 
-		string eventName = EnumTools.EnumToString(LogZ_Event, eventType);
-		eventName.ToLower();
-		eventName.Replace("_", ".");
+		if (!s_Names)
+			InitNames();
+
+		if (s_Names[bit] == string.Empty)
+			return "none";
+
+		return s_Names[bit];
+	}
+
+	/**
+	    \brief Register name of event type added by other mod.
+	    \details Custom event must be a single free bit from CUSTOM_MASK (1 << 26 .. 1 << 30).
+	             It is enabled by integer `events_mask` containing its bit or by "-1".
+	    \param eventType Single bit event value.
+	    \param name      Lowercase "namespace.name" string, must not need JSON escaping.
+	    \return bool True if registered.
+	*/
+	static bool Register(int eventType, string name)
+	{
+		if ((eventType & CUSTOM_MASK) == 0 || name == string.Empty)
+			return false;
+
+		// event_type is written without escaping
+		if (LogZ_Json.Escape(name) != name)
+			return false;
+
+		int bit = BitIndex(eventType);
+		if (bit < 0)
+			return false;
+
+		if (!s_Names)
+			InitNames();
+
+		s_Names[bit] = name;
+
+		return true;
+	}
+
+	/**
+	    \brief Check if custom event type is registered.
+	*/
+	static bool IsRegistered(int eventType)
+	{
+		if ((eventType & CUSTOM_MASK) == 0)
+			return false;
+
+		return ToString(eventType) != "none";
+	}
+
+	/**
+	    \brief Bit position of single bit event.
+	    \return int 0..BITS-1 or -1 if value is not a single bit.
+	*/
+	static int BitIndex(int eventType)
+	{
+		if (eventType <= 0 || (eventType & (eventType - 1)) != 0)
+			return -1;
+
+		int bit = 0;
+		while (eventType > 1) {
+			eventType = eventType >> 1;
+			bit++;
+		}
+
+		return bit;
+	}
 
-		return eventName;
+	/**
+	    \brief Build names table for built-in events.
+	*/
+	protected static void InitNames()
+	{
+		s_Names = new array<string>();
+		s_Names.Resize(BITS);
+
+		for (int bit = 0; bit < BITS; ++bit) {
+			int eventType = 1 << bit;
+			if (eventType >= LogZ_Event.MAX)
+				continue;
+
+			string eventName = EnumTools.EnumToString(LogZ_Event, eventType);
+			eventName.ToLower();
+			eventName.Replace("_", ".");
+			s_Names[bit] = eventName;
+		}
 	}
 
 	/**
@@ -10,6 +10,24 @@
 */
 class LogZ_GameLogger
 {
+	protected static ref LogZ_JsonWriter s_Writer = new LogZ_JsonWriter();
+	protected static ref LogZ_Payload s_Payload = new LogZ_Payload();
+
+	// Reused object DTOs, one per class, loaded right before writing
+	protected static ref LogZ_DTO_Man s_Man = new LogZ_DTO_Man(null);
+	protected static ref LogZ_DTO_ManStats s_ManStats = new LogZ_DTO_ManStats(null);
+	protected static ref LogZ_DTO_Transport s_Transport = new LogZ_DTO_Transport(null);
+	protected static ref LogZ_DTO_TransportStats s_TransportStats = new LogZ_DTO_TransportStats(null);
+	protected static ref LogZ_DTO_Entity s_Entity = new LogZ_DTO_Entity(null);
+	protected static ref LogZ_DTO_EntityStats s_EntityStats = new LogZ_DTO_EntityStats(null);
+	protected static ref LogZ_DTO_Object s_Object = new LogZ_DTO_Object(null);
+	protected static ref LogZ_DTO_ObjectStats s_ObjectStats = new LogZ_DTO_ObjectStats(null);
+
+	// Per-frame object snapshots, cleared when uptime changes
+	protected static int s_MemoTime = -1;
+	protected static ref map<Object, string> s_Memo = new map<Object, string>();
+	protected static ref map<Object, string> s_MemoStats = new map<Object, string>();
+
 	/**
 	    \brief Log message with single object payload.
 	    \details
@@ -29,19 +47,18 @@ class LogZ_GameLogger
 		if (!obj || !LogZ_Levels.IsEnabled(lvl) || !LogZ_Events.IsEnabled(ev))
 			return;
 
-		ref map<string, string> dto = new map<string, string>();
-		string json;
+		LogZ_Payload payload = s_Payload;
+		payload.Reset();
 
-		if (SerializeObject(obj, json, withStats))
-			dto.Insert("object", json);
+		AddObject(payload, "object", obj, withStats);
 
 		if (IsAllowedSlotName(slot))
-			dto.Insert("slot", slot);
+			payload.AddString("slot", slot);
 
-		if (withParent && SerializeParentObject(obj, json, withStats))
-			dto.Insert("object_parent", json);
+		if (withParent)
+			AddParentObject(payload, "object_parent", obj, withStats);
 
-		LogZ.Log(msg, lvl, ev, dto);
+		LogZ.LogWith(msg, lvl, ev, payload);
 	}
 
 	/**
@@ -64,38 +81,119 @@ class LogZ_GameLogger
 		if (!obj || !LogZ_Levels.IsEnabled(lvl) || !LogZ_Events.IsEnabled(ev))
 			return;
 
-		ref map<string, string> dto = new map<string, string>();
-		string json;
+		LogZ_Payload payload = s_Payload;
+		payload.Reset();
 
-		if (SerializeObject(obj, json, withStats))
-			dto.Insert("object", json);
+		AddObject(payload, "object", obj, withStats);
 
-		if (withParents && SerializeParentObject(obj, json, withStats))
-			dto.Insert("object_parent", json);
+		if (withParents)
+			AddParentObject(payload, "object_parent", obj, withStats);
 
 		if (IsAllowedSlotName(slot))
-			dto.Insert("slot", slot);
+			payload.AddString("slot", slot);
 
 		if (owner && obj != owner) {
-			if (SerializeObject(owner, json, withStats))
-				dto.Insert("owner", json);
+			AddObject(payload, "owner", owner, withStats);
+
+			if (withParents)
+				AddParentObject(payload, "owner_parent", owner, withStats);
+		}
+
+		LogZ.LogWith(msg, lvl, ev, payload);
+	}
+
+	/**
+	    \brief Write object DTO into payload.
+	    \param payload   Target payload.
+	    \param key       Field name.
+	    \param obj       Source object, null is skipped.
+	    \param withStats When true, use *Stats DTO variant.
+	*/
+	static void AddObject(LogZ_Payload payload, string key, Object obj, bool withStats = false)
+	{
+		payload.AddObject(key, LoadObjectDTO(obj, withStats));
+	}
+
+	/**
+	    \brief Write hierarchy root DTO of an EntityAI into payload.
+	    \details Skipped when object has no parent.
+	    \param payload   Target payload.
+	    \param key       Field name.
+	    \param obj       Child object.
+	    \param withStats Use *Stats DTO for parent if true.
+	*/
+	static void AddParentObject(LogZ_Payload payload, string key, Object obj, bool withStats = false)
+	{
+		Object parent = GetParentObject(obj);
+		if (parent)
+			AddObject(payload, key, parent, withStats);
+	}
+
+	/**
+	    \brief Write object snapshot rendered once per frame into payload.
+	    \details Use for objects whose state does not change between several logs
+	             in the same frame, e.g. attacker of multiple pellet or explosion hits.
+	    \param payload   Target payload.
+	    \param key       Field name.
+	    \param obj       Source object, null is skipped.
+	    \param withStats When true, use *Stats DTO variant.
+	*/
+	static void AddObjectCached(LogZ_Payload payload, string key, Object obj, bool withStats = false)
+	{
+		string json;
+		if (SerializeObjectCached(obj, json, withStats))
+			payload.AddRawJson(key, json);
+	}
+
+	/**
+	    \brief Write hierarchy root snapshot rendered once per frame into payload.
+	    \details Skipped when object has no parent.
+	*/
+	static void AddParentObjectCached(LogZ_Payload payload, string key, Object obj, bool withStats = false)
+	{
+		Object parent = GetParentObject(obj);
+		if (parent)
+			AddObjectCached(payload, key, parent, withStats);
+	}
+
+	/**
+	    \brief Serialize object into a JSON DTO string once per frame.
+	    \details Snapshots are keyed by object and DTO variant, dropped when uptime changes.
+	    \param obj       Source object.
+	    \param json[out] Resulting JSON string.
+	    \param withStats When true, use *Stats DTO variant.
+	    \return bool     True on success.
+	*/
+	static bool SerializeObjectCached(Object obj, out string json, bool withStats = false)
+	{
+		if (!obj)
+			return false;
 
-			if (withParents && SerializeParentObject(obj, json, withStats))
-				dto.Insert("owner_parent", json);
+		int now = g_Game.GetTime();
+		if (now != s_MemoTime) {
+			s_MemoTime = now;
+			s_Memo.Clear();
+			s_MemoStats.Clear();
 		}
 
-		LogZ.Log(msg, lvl, ev, dto);
+		map<Object, string> memo = s_Memo;
+		if (withStats)
+			memo = s_MemoStats;
+
+		if (memo.Find(obj, json))
+			return true;
+
+		if (!SerializeObject(obj, json, withStats))
+			return false;
+
+		memo.Insert(obj, json);
+
+		return true;
 	}
 
 	/**
 	    \brief Serialize object into a JSON DTO string.
-	    \details
-	        - Selects DTO type by object runtime type:
-	            Man -> LogZ_DTO_Man / LogZ_DTO_ManStats
-	            Transport -> LogZ_DTO_Transport / LogZ_DTO_TransportStats
-	            EntityAI -> LogZ_DTO_Entity / LogZ_DTO_EntityStats
-	            other -> LogZ_DTO_Object / LogZ_DTO_ObjectStats
-	        - Returns false if serializer or object invalid.
+	    \details DTO type is selected same as in CreateObjectDTO.
 	    \param obj       Source object.
 	    \param json[out] Resulting JSON string.
 	    \param withStats When true, use *Stats DTO variant.
@@ -103,46 +201,99 @@ class LogZ_GameLogger
 	*/
 	static bool SerializeObject(Object obj, out string json, bool withStats = false)
 	{
-		if (!obj)
+		LogZ_DTO_Base dto = LoadObjectDTO(obj, withStats);
+		if (!dto)
 			return false;
 
+		s_Writer.Reset();
+		dto.Write(s_Writer);
+		json = s_Writer.GetJson();
+
+		return true;
+	}
+
+	/**
+	    \brief Create DTO for object by its runtime type.
+	    \details
+	        - Man -> LogZ_DTO_Man / LogZ_DTO_ManStats
+	        - Transport -> LogZ_DTO_Transport / LogZ_DTO_TransportStats
+	        - EntityAI -> LogZ_DTO_Entity / LogZ_DTO_EntityStats
+	        - other -> LogZ_DTO_Object / LogZ_DTO_ObjectStats
+	    \param obj       Source object.
+	    \param withStats When true, use *Stats DTO variant.
+	    \return LogZ_DTO_Base DTO or null if object is null.
+	*/
+	static LogZ_DTO_Base CreateObjectDTO(Object obj, bool withStats = false)
+	{
+		if (!obj)
+			return null;
+
 		if (obj.IsMan()) {
-			if (withStats) {
-				LogZ_DTO_ManStats manStatsDTO = new LogZ_DTO_ManStats(obj);
-				return LogZ.GetSerializer().WriteToString(manStatsDTO, false, json);
-			}
+			if (withStats)
+				return new LogZ_DTO_ManStats(obj);
 
-			LogZ_DTO_Man manDTO = new LogZ_DTO_Man(obj);
-			return (LogZ.GetSerializer().WriteToString(manDTO, false, json));
+			return new LogZ_DTO_Man(obj);
 		}
 
 		if (obj.IsTransport()) {
-			if (withStats) {
-				LogZ_DTO_TransportStats vehicleStatsDTO = new LogZ_DTO_TransportStats(obj);
-				return LogZ.GetSerializer().WriteToString(vehicleStatsDTO, false, json);
-			}
+			if (withStats)
+				return new LogZ_DTO_TransportStats(obj);
 
-			LogZ_DTO_Transport vehicleDTO = new LogZ_DTO_Transport(obj);
-			return (LogZ.GetSerializer().WriteToString(vehicleDTO, false, json));
+			return new LogZ_DTO_Transport(obj);
 		}
 
 		if (obj.IsEntityAI()) {
-			if (withStats) {
-				LogZ_DTO_EntityStats entityStatsDTO = new LogZ_DTO_EntityStats(obj);
-				return LogZ.GetSerializer().WriteToString(entityStatsDTO, false, json);
-			}
+			if (withStats)
+				return new LogZ_DTO_EntityStats(obj);
 
-			LogZ_DTO_Entity entityDTO = new LogZ_DTO_Entity(obj);
-			return LogZ.GetSerializer().WriteToString(entityDTO, false, json);
+			return new LogZ_DTO_Entity(obj);
 		}
 
-		if (withStats) {
-			LogZ_DTO_ObjectStats objStatsDTO = new LogZ_DTO_ObjectStats(obj);
-			return LogZ.GetSerializer().WriteToString(objStatsDTO, false, json);
+		if (withStats)
+			return new LogZ_DTO_ObjectStats(obj);
+
+		return new LogZ_DTO_Object(obj);
+	}
+
+	/**
+	    \brief Load object into shared DTO of matching class.
+	    \details Same DTO selection as CreateObjectDTO without allocation.
+	             Returned DTO is valid only until the next call, write it right away.
+	    \param obj       Source object.
+	    \param withStats When true, use *Stats DTO variant.
+	    \return LogZ_DTO_Object_Base Shared DTO or null if object is null.
+	*/
+	protected static LogZ_DTO_Object_Base LoadObjectDTO(Object obj, bool withStats = false)
+	{
+		if (!obj)
+			return null;
+
+		LogZ_DTO_Object_Base dto;
+		if (obj.IsMan()) {
+			if (withStats)
+				dto = s_ManStats;
+			else
+				dto = s_Man;
+		} else if (obj.IsTransport()) {
+			if (withStats)
+				dto = s_TransportStats;
+			else
+				dto = s_Transport;
+		} else if (obj.IsEntityAI()) {
+			if (withStats)
+				dto = s_EntityStats;
+			else
+				dto = s_Entity;
+		} else {
+			if (withStats)
+				dto = s_ObjectStats;
+			else
+				dto = s_Object;
 		}
 
-		LogZ_DTO_Object objDTO = new LogZ_DTO_Object(obj);
-		return LogZ.GetSerializer().WriteToString(objDTO, false, json);
+		dto.Load(obj);
+
+		return dto;
 	}
 
 	/**
@@ -157,18 +308,31 @@ class LogZ_GameLogger
 	*/
 	static bool SerializeParentObject(Object obj, out string json, bool withStats = false)
 	{
-		if (!obj || !obj.IsEntityAI())
+		Object parent = GetParentObject(obj);
+		if (!parent)
 			return false;
 
+		return SerializeObject(parent, json, withStats);
+	}
+
+	/**
+	    \brief Hierarchy root of an EntityAI.
+	    \return Object Root or null for non-EntityAI and root objects.
+	*/
+	static Object GetParentObject(Object obj)
+	{
+		if (!obj || !obj.IsEntityAI())
+			return null;
+
 		EntityAI eai = EntityAI.Cast(obj);
 		if (!eai)
-			return false;
+			return null;
 
 		EntityAI parent = eai.GetHierarchyRoot();
 		if (!parent || parent == eai)
-			return false;
+			return null;
 
-		return SerializeObject(parent, json, withStats);
+		return parent;
 	}
 
 	/**
@@ -0,0 +1,307 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/logz
+*/
+
+#ifdef SERVER
+/**
+    \brief Completion callback of one HTTP batch.
+*/
+class LogZ_HttpCallback : RestCallback
+{
+	protected LogZ_HttpSink m_Sink;
+	protected string m_Batch;
+	protected int m_Seq;
+
+	void LogZ_HttpCallback(LogZ_HttpSink sink, string batch, int seq)
+	{
+		m_Sink = sink;
+		m_Batch = batch;
+		m_Seq = seq;
+	}
+
+	/**
+	    \brief NDJSON body of this request.
+	*/
+	string GetBatch()
+	{
+		return m_Batch;
+	}
+
+	/**
+	    \brief Sequence number of the batch in flush order.
+	*/
+	int GetSeq()
+	{
+		return m_Seq;
+	}
+
+	override void OnSuccess(string data, int dataSize)
+	{
+		if (m_Sink)
+			m_Sink.OnBatchDone(this, true);
+	}
+
+	override void OnError(int errorCode)
+	{
+#ifdef DIAG
+		ErrorEx("LogZ: [HttpSink] Request failed with error " + errorCode, ErrorExSeverity.INFO);
+#endif
+		if (m_Sink)
+			m_Sink.OnBatchDone(this, false);
+	}
+
+	override void OnTimeout()
+	{
+#ifdef DIAG
+		ErrorEx("LogZ: [HttpSink] Request timeout", ErrorExSeverity.INFO);
+#endif
+		if (m_Sink)
+			m_Sink.OnBatchDone(this, false);
+	}
+}
+
+/**
+    \brief Sink pushing buffered NDJSON lines to HTTP endpoint.
+    \details Reuses LogZ_Sink buffering, every flushed chunk becomes one POST body.
+             Incremental flush is disabled, so a flush is never split into several requests.
+             At most max_in_flight requests are active, other batches wait in queue,
+             failed batches are put back to the queue by flush order and sent again after
+             retry_interval. When queue is full the oldest batch is dropped.
+             On shutdown remaining queue is sent as one combined batch.
+*/
+class LogZ_HttpSink : LogZ_Sink
+{
+	protected RestContext m_Ctx;
+	protected string m_Url;
+	protected string m_Path;
+	protected string m_ContentType;
+	protected bool m_KeepFile;
+	protected int m_MaxInFlight;
+	protected int m_MaxQueued;
+	protected int m_RetryIntervalMs;
+	protected bool m_IsRetryWaiting;
+	protected int m_DroppedBatches;
+	protected int m_NextSeq;
+	protected ref array<string> m_Queue = new array<string>();
+	protected ref array<int> m_QueueSeq = new array<int>(); // flush order of m_Queue items
+	protected ref array<ref LogZ_HttpCallback> m_InFlight = new array<ref LogZ_HttpCallback>();
+
+	/**
+	    \brief Initialize the sink using file buffering and http configuration.
+	    \param cfgFile Resolved file config, global `file` when null.
+	*/
+	override void Init(LogZ_ConfigDTO_File cfgFile = null)
+	{
+		if (!LogZ_Config.IsLoaded()) {
+			ErrorEx("LogZ: Config not loaded, sink init failed", ErrorExSeverity.ERROR);
+			return;
+		}
+
+		LogZ_ConfigDTO_Http cfgHttp = LogZ_Config.Get().http;
+		m_Url = cfgHttp.url;
+		m_Path = cfgHttp.path;
+		m_ContentType = cfgHttp.content_type;
+		m_KeepFile = cfgHttp.keep_file;
+		m_MaxInFlight = cfgHttp.max_in_flight;
+		m_MaxQueued = cfgHttp.max_queued_batches;
+		m_RetryIntervalMs = cfgHttp.retry_interval * 1000;
+		m_IsRetryWaiting = false;
+		m_DroppedBatches = 0;
+		m_NextSeq = 0;
+		m_Queue.Clear();
+		m_QueueSeq.Clear();
+		m_InFlight.Clear();
+
+		super.Init(cfgFile);
+
+		// one flush - one request
+		m_FrameBytes = 0;
+	}
+
+	/**
+	    \brief Create REST context, open log file too if keep_file is set.
+	*/
+	override protected bool OpenOutput()
+	{
+		if (m_KeepFile && !super.OpenOutput())
+			return false;
+
+		RestApi api = GetRestApi();
+		if (!api)
+			api = CreateRestApi();
+
+		if (api)
+			m_Ctx = api.GetRestContext(m_Url);
+
+		if (!m_Ctx) {
+			ErrorEx("LogZ: Failed to create HTTP context for: " + m_Url, ErrorExSeverity.ERROR);
+			return false;
+		}
+
+		m_Ctx.SetHeader(m_ContentType);
+
+		return true;
+	}
+
+	override protected bool IsOpen()
+	{
+		return m_Ctx != null;
+	}
+
+	/**
+	    \brief Queue chunk as one batch, write it to file too if keep_file is set.
+	*/
+	override protected void WriteChunk(string chunk)
+	{
+		if (chunk == string.Empty)
+			return;
+
+		if (m_KeepFile)
+			super.WriteChunk(chunk);
+
+		if (m_Queue.Count() >= m_MaxQueued)
+			DropOldestBatch();
+
+		m_Queue.Insert(chunk);
+		m_QueueSeq.Insert(m_NextSeq);
+		m_NextSeq++;
+		Pump();
+	}
+
+	override protected void CloseOutput()
+	{
+		super.CloseOutput();
+		m_Ctx = null;
+	}
+
+	/**
+	    \brief Called by request callback when request is done.
+	    \param cb Finished request.
+	    \param ok True if endpoint accepted the batch.
+	*/
+	void OnBatchDone(LogZ_HttpCallback cb, bool ok)
+	{
+		// keep callback alive until the end of this call
+		LogZ_HttpCallback done = cb;
+		m_InFlight.RemoveItem(cb);
+
+		if (ok) {
+#ifdef METRICZ
+			LogZ.MetricHttpSentBytesAdd(done.GetBatch().Length());
+#endif
+			Pump();
+			return;
+		}
+
+#ifdef METRICZ
+		LogZ.MetricHttpFailedInc();
+#endif
+
+		if (m_IsShutdown)
+			return;
+
+		if (m_Queue.Count() >= m_MaxQueued)
+			DropOldestBatch();
+
+		// put failed batch back before newer ones, several failures keep their flush order
+		int seq = done.GetSeq();
+		int pos = 0;
+		while (pos < m_QueueSeq.Count() && m_QueueSeq[pos] < seq)
+			pos++;
+
+		m_Queue.InsertAt(done.GetBatch(), pos);
+		m_QueueSeq.InsertAt(seq, pos);
+
+		if (!m_IsRetryWaiting) {
+			m_IsRetryWaiting = true;
+			g_Game.GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(OnRetryTick, m_RetryIntervalMs, false);
+		}
+	}
+
+	/**
+	    \brief Send queued batches up to max_in_flight requests.
+	*/
+	protected void Pump()
+	{
+		if (!m_Ctx || m_IsRetryWaiting)
+			return;
+
+		while (m_Queue.Count() > 0 && m_InFlight.Count() < m_MaxInFlight) {
+			string batch = m_Queue[0];
+			int seq = m_QueueSeq[0];
+			m_Queue.RemoveOrdered(0);
+			m_QueueSeq.RemoveOrdered(0);
+
+			Send(batch, seq);
+		}
+	}
+
+	/**
+	    \brief POST one batch and track it as in flight.
+	*/
+	protected void Send(string batch, int seq)
+	{
+		LogZ_HttpCallback cb = new LogZ_HttpCallback(this, batch, seq);
+		m_InFlight.Insert(cb);
+		m_Ctx.POST(cb, m_Path, batch);
+	}
+
+	/**
+	    \brief Retry delay is over, resume sending.
+	*/
+	protected void OnRetryTick()
+	{
+		m_IsRetryWaiting = false;
+		Pump();
+	}
+
+	/**
+	    \brief Drop the oldest queued batch to make room for a new one.
+	*/
+	protected void DropOldestBatch()
+	{
+		if (m_Queue.Count() < 1)
+			return;
+
+		m_Queue.RemoveOrdered(0);
+		m_QueueSeq.RemoveOrdered(0);
+		m_DroppedBatches++;
+
+#ifdef METRICZ
+		LogZ.MetricHttpDroppedInc();
+#endif
+	}
+
+	/**
+	    \brief Flush buffer and send queued batches left over max_in_flight as one final request.
+	*/
+	override void Shutdown()
+	{
+		if (m_IsShutdown)
+			return;
+
+		super.Shutdown();
+
+		g_Game.GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(OnRetryTick);
+		m_IsRetryWaiting = false;
+		Pump();
+
+		if (m_Ctx && m_Queue.Count() > 0) {
+			// batches are whole NDJSON lines, concatenation keeps body valid
+			string rest;
+			foreach (string batch : m_Queue)
+				rest += batch;
+
+			int seq = m_QueueSeq[0];
+			m_Queue.Clear();
+			m_QueueSeq.Clear();
+			Send(rest, seq);
+		}
+
+		if (m_DroppedBatches > 0)
+			ErrorEx("LogZ: http sink dropped " + m_DroppedBatches + " batches on queue overflow", ErrorExSeverity.WARNING);
+	}
+}
+#endif
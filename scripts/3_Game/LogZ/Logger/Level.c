@@ -23,6 +23,9 @@ enum LogZ_Level {
 */
 class LogZ_Levels
 {
+	// Level names indexed by LogZ_Level
+	static const ref array<string> NAMES = {"trace", "debug", "info", "warn", "error", "fatal", "off"};
+
 	/**
 	    \brief Check if level passes current threshold.
 	*/
@@ -46,10 +49,7 @@ class LogZ_Levels
 		if (lvl < LogZ_Level.TRACE || lvl >= LogZ_Level.OFF)
 			return "off";
 
-		string logLevel = EnumTools.EnumToString(LogZ_Level, lvl);
-		logLevel.ToLower();
-
-		return logLevel;
+		return NAMES[lvl];
 	}
 
 	/**
@@ -100,5 +100,29 @@ class LogZ_Levels
 
 		return LogZ_Level.INFO;
 	}
+
+	/**
+	    \brief Strictly parse level name or integer literal.
+	    \details Unlike FromString accepts only full names and numbers 0..6.
+	    \param[out] result Parsed level, unchanged on invalid input.
+	    \return bool False on empty or unknown input.
+	*/
+	static bool TryFromString(string lvl, out LogZ_Level result)
+	{
+		lvl.TrimInPlace();
+		lvl.ToLower();
+		if (lvl == string.Empty)
+			return false;
+
+		int idx = NAMES.Find(lvl);
+		if (idx == -1) {
+			idx = lvl.ToInt();
+			if (idx.ToString() != lvl || idx < LogZ_Level.TRACE || idx > LogZ_Level.OFF)
+				return false;
+		}
+
+		result = idx;
+		return true;
+	}
 }
 #endif
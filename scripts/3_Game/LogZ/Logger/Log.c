@@ -11,7 +11,12 @@
 class LogZ
 {
 	private static ref LogZ_Sink s_Sink;
+	private static ref array<ref LogZ_Sink> s_RouteSinks = new array<ref LogZ_Sink>();
+	private static ref array<int> s_RouteMasks = new array<int>();
 	private static ref JsonSerializer s_JS;
+	private static ref LogZ_JsonWriter s_Writer;
+	private static ref LogZ_Payload s_MapPayload = new LogZ_Payload();
+	private static ref LogZ_DTO_Root s_Root = new LogZ_DTO_Root(LogZ_Level.INFO, string.Empty, LogZ_Event.NONE);
 
 #ifdef METRICZ
 	// logging time spent
@@ -19,6 +24,10 @@ class LogZ
 	// sink metrics
 	protected static ref MetricZ_MetricInt m_MetricFlushes;
 	protected static ref MetricZ_MetricInt m_MetricBytes;
+	protected static ref MetricZ_MetricInt m_MetricBufferBytes;
+	protected static ref MetricZ_MetricInt m_MetricHttpSentBytes;
+	protected static ref MetricZ_MetricInt m_MetricHttpFailed;
+	protected static ref MetricZ_MetricInt m_MetricHttpDropped;
 	// count log events by level
 	protected static ref MetricZ_MetricInt s_MetricTrace;
 	protected static ref MetricZ_MetricInt s_MetricDebug;
@@ -26,6 +35,8 @@ class LogZ
 	protected static ref MetricZ_MetricInt s_MetricWarn;
 	protected static ref MetricZ_MetricInt s_MetricError;
 	protected static ref MetricZ_MetricInt s_MetricFatal;
+	// count dropped lines by level (indexed by LogZ_Level)
+	protected static ref array<ref MetricZ_MetricInt> s_MetricDropped = new array<ref MetricZ_MetricInt>();
 	// metrics registry
 	protected static ref array<ref MetricZ_MetricBase> s_MetricsRegistry = new array<ref MetricZ_MetricBase>();
 #endif
@@ -38,13 +49,34 @@ class LogZ
 		if (!LogZ_Config.IsLoaded())
 			LogZ_Config.Get();
 
-		// Initialize Sink
-		s_Sink = new LogZ_Sink();
+		// Initialize Sink, push over HTTP if endpoint is configured
+		if (LogZ_Config.Get().http.url != string.Empty)
+			s_Sink = new LogZ_HttpSink();
+		else
+			s_Sink = new LogZ_Sink();
+
 		s_Sink.Init();
 
+		// Initialize routed sinks
+		s_RouteSinks.Clear();
+		s_RouteMasks.Clear();
+		foreach (LogZ_ConfigDTO_Route route : LogZ_Config.Get().routes) {
+			if (!route || route.name == string.Empty || route.events_mask_int == LogZ_Event.NONE)
+				continue;
+
+			LogZ_Sink routeSink = new LogZ_Sink();
+			routeSink.Init(route.file);
+
+			s_RouteSinks.Insert(routeSink);
+			s_RouteMasks.Insert(route.events_mask_int);
+		}
+
 		if (!s_JS)
 			s_JS = new JsonSerializer();
 
+		if (!s_Writer)
+			s_Writer = new LogZ_JsonWriter();
+
 #ifdef METRICZ
 		InitMetrics();
 #endif
@@ -52,6 +84,7 @@ class LogZ
 
 	/**
 	    \brief Access shared JsonSerializer instance.
+	    \note Not used for log lines anymore, kept for mods serializing own DTOs.
 	*/
 	static JsonSerializer GetSerializer()
 	{
@@ -60,52 +93,64 @@ class LogZ
 
 	/**
 	    \brief Emit a log line if level is allowed.
-	    \details Serializes LogZ_DTO_Root and merges "extra" map as additional JSON fields.
+	    \details Converts "extra" map into LogZ_Payload and passes it to LogWith.
 	           Values that look like JSON are inserted raw, otherwise quoted and escaped.
-	    \warning Serializer lacks polymorphism and cannot merge object + map<string,string>.
-	           Workaround: write base JSON to string, trim "}", append fields:
-	           if value looks like JSON insert raw, otherwise escape and quote.
-	           Fast and reliable, but the whole flow is a maintenance nightmare.
-	           Greetings to the game authors.
+	           Prefer LogWith with typed payload, map values are re-parsed here.
 	    \param lvl   Severity level.
 	    \param msg   Message string.
 	    \param extra Optional map of extra fields.
 	*/
 	static void Log(string msg, LogZ_Level lvl, LogZ_Event eventType = 0, map<string, string> extra = null)
 	{
-		if (!s_Sink || !s_JS || !LogZ_Levels.IsEnabled(lvl) || !LogZ_Events.IsEnabled(eventType))
+		if (!s_Sink || !s_Writer || !LogZ_Levels.IsEnabled(lvl) || !LogZ_Events.IsEnabled(eventType))
 			return;
 
-#ifdef METRICZ
-		float t0 = g_Game.GetTickTime();
-#endif
+		if (!extra) {
+			LogWith(msg, lvl, eventType, null);
+			return;
+		}
 
-		LogZ_DTO_Root base = new LogZ_DTO_Root(lvl, msg, eventType);
+		s_MapPayload.Reset();
+		foreach (string key, string value : extra) {
+			if (LogZ_Json.IsValue(value))
+				s_MapPayload.AddRawJson(LogZ_Json.Escape(key), value);
+			else
+				s_MapPayload.AddString(LogZ_Json.Escape(key), value);
+		}
 
-		string result;
-		if (!s_JS.WriteToString(base, false, result))
+		LogWith(msg, lvl, eventType, s_MapPayload);
+	}
+
+	/**
+	    \brief Emit a log line with typed extra fields if level is allowed.
+	    \details Writes LogZ_DTO_Root fields and payload fields into one line with LogZ_JsonWriter.
+	    \param msg       Message string.
+	    \param lvl       Severity level.
+	    \param eventType Event type.
+	    \param payload   Optional extra fields.
+	*/
+	static void LogWith(string msg, LogZ_Level lvl, LogZ_Event eventType, LogZ_Payload payload)
+	{
+		if (!s_Sink || !s_Writer || !LogZ_Levels.IsEnabled(lvl) || !LogZ_Events.IsEnabled(eventType))
 			return;
 
-		if (extra && extra.Count() > 0) {
-			// drop trailing "}"
-			result = result.Substring(0, result.Length() - 1);
+#ifdef METRICZ
+		float t0 = g_Game.GetTickTime();
+#endif
 
-			foreach (string key, string value : extra) {
-				if (key == string.Empty || value == string.Empty)
-					continue;
+		s_Root.Load(lvl, msg, eventType);
 
-				if (LogZ_Json.IsValue(value))
-					// ! only append long json body, because string.Format cant hold long lines
-					result += string.Format(",\"%1\":", LogZ_Json.Escape(key)) + value;
-				else
-					result += string.Format(",\"%1\":\"%2\"", LogZ_Json.Escape(key), LogZ_Json.Escape(value));
-			}
+		s_Writer.Reset();
+		s_Writer.BeginObject();
+		s_Root.WriteFields(s_Writer);
 
-			result += "}";
-		}
+		if (payload && payload.Count() > 0)
+			s_Writer.AddFields(payload.GetFields());
+
+		s_Writer.EndObject();
 
-		// Pass the constructed JSON line to the Sink
-		s_Sink.Write(result);
+		// Pass the constructed JSON line to the routed Sink
+		GetSink(eventType).Write(s_Writer.GetJson(), lvl);
 
 #ifdef METRICZ
 		s_MetricLogTime.Add(g_Game.GetTickTime() - t0);
@@ -138,6 +183,19 @@ class LogZ
 #endif
 	}
 
+	/**
+	    \brief Sink for event type, first matching route or default file.
+	*/
+	static LogZ_Sink GetSink(LogZ_Event eventType)
+	{
+		for (int i = 0; i < s_RouteMasks.Count(); ++i) {
+			if ((s_RouteMasks[i] & eventType) != 0)
+				return s_RouteSinks[i];
+		}
+
+		return s_Sink;
+	}
+
 	/**
 	     \brief Shorthand for TRACE.
 	*/
@@ -194,6 +252,9 @@ class LogZ
 		if (s_Sink)
 			s_Sink.Shutdown();
 
+		foreach (LogZ_Sink routeSink : s_RouteSinks)
+			routeSink.Shutdown();
+
 		ErrorEx("LogZ: stopped", ErrorExSeverity.INFO);
 	}
 
@@ -208,7 +269,7 @@ class LogZ
 			return;
 
 		foreach (MetricZ_MetricBase metric : s_MetricsRegistry) {
-			if (metric == s_MetricLogTime || metric == m_MetricFlushes || metric == m_MetricBytes || metric == s_MetricTrace)
+			if (metric == s_MetricLogTime || metric == m_MetricFlushes || metric == m_MetricBytes || metric == m_MetricBufferBytes || metric == m_MetricHttpSentBytes || metric == m_MetricHttpFailed || metric == m_MetricHttpDropped || metric == s_MetricTrace || metric == s_MetricDropped[0])
 				metric.FlushWithHead(sink);
 			else
 				metric.Flush(sink);
@@ -233,6 +294,60 @@ class LogZ
 			m_MetricBytes.Add(value);
 	}
 
+	/**
+	    \brief Update current size of buffered lines pending write, summed over all sinks.
+	*/
+	static void MetricBufferBytesUpdate()
+	{
+		if (!m_MetricBufferBytes)
+			return;
+
+		int pending;
+		if (s_Sink)
+			pending = s_Sink.PendingBytes();
+
+		foreach (LogZ_Sink routeSink : s_RouteSinks)
+			pending += routeSink.PendingBytes();
+
+		m_MetricBufferBytes.Set(pending);
+	}
+
+	/**
+	    \brief Increment bytes accepted by HTTP endpoint metric by given value.
+	*/
+	static void MetricHttpSentBytesAdd(int value)
+	{
+		if (m_MetricHttpSentBytes)
+			m_MetricHttpSentBytes.Add(value);
+	}
+
+	/**
+	    \brief Increment failed HTTP requests metric.
+	*/
+	static void MetricHttpFailedInc()
+	{
+		if (m_MetricHttpFailed)
+			m_MetricHttpFailed.Inc();
+	}
+
+	/**
+	    \brief Increment dropped HTTP batches metric.
+	*/
+	static void MetricHttpDroppedInc()
+	{
+		if (m_MetricHttpDropped)
+			m_MetricHttpDropped.Inc();
+	}
+
+	/**
+	    \brief Increment dropped lines metric for given level.
+	*/
+	static void MetricDroppedInc(LogZ_Level lvl)
+	{
+		if (lvl >= 0 && lvl < s_MetricDropped.Count())
+			s_MetricDropped[lvl].Inc();
+	}
+
 	/**
 	    \brief Create and register LogZ metrics in private registry.
 	    \details Metrics created once; subsequent calls are no-op.
@@ -260,6 +375,30 @@ class LogZ
 		    MetricZ_MetricType.COUNTER);
 		s_MetricsRegistry.Insert(m_MetricBytes);
 
+		m_MetricBufferBytes = new MetricZ_MetricInt(
+		    "logz_buffer_bytes",
+		    "Current size of buffered log lines pending write in bytes, summed over all sinks",
+		    MetricZ_MetricType.GAUGE);
+		s_MetricsRegistry.Insert(m_MetricBufferBytes);
+
+		m_MetricHttpSentBytes = new MetricZ_MetricInt(
+		    "logz_http_sent_bytes_total",
+		    "Total size of logs accepted by HTTP endpoint in bytes",
+		    MetricZ_MetricType.COUNTER);
+		s_MetricsRegistry.Insert(m_MetricHttpSentBytes);
+
+		m_MetricHttpFailed = new MetricZ_MetricInt(
+		    "logz_http_failed_requests_total",
+		    "Total number of failed or timed out HTTP push requests",
+		    MetricZ_MetricType.COUNTER);
+		s_MetricsRegistry.Insert(m_MetricHttpFailed);
+
+		m_MetricHttpDropped = new MetricZ_MetricInt(
+		    "logz_http_dropped_batches_total",
+		    "Total number of log batches dropped on HTTP queue overflow",
+		    MetricZ_MetricType.COUNTER);
+		s_MetricsRegistry.Insert(m_MetricHttpDropped);
+
 		s_MetricTrace = NewLogMetric(LogZ_Level.TRACE);
 		s_MetricsRegistry.Insert(s_MetricTrace);
 
@@ -277,6 +416,20 @@ class LogZ
 
 		s_MetricFatal = NewLogMetric(LogZ_Level.FATAL);
 		s_MetricsRegistry.Insert(s_MetricFatal);
+
+		for (int lvl = LogZ_Level.TRACE; lvl < LogZ_Level.OFF; lvl++) {
+			MetricZ_MetricInt dropped = new MetricZ_MetricInt(
+			    "logz_dropped_lines",
+			    "Total log lines dropped on sink buffer overflow by level",
+			    MetricZ_MetricType.COUNTER);
+
+			string labelValue = EnumTools.EnumToString(LogZ_Level, lvl);
+			labelValue.ToLower();
+			dropped.MakeLabel("level", labelValue);
+
+			s_MetricDropped.Insert(dropped);
+			s_MetricsRegistry.Insert(dropped);
+		}
 	}
 
 	/**
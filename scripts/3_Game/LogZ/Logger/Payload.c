@@ -0,0 +1,121 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/logz
+*/
+
+#ifdef SERVER
+/**
+    \brief Typed extra fields of a log line.
+    \details Values are written to JSON once, when added, and appended to the line
+             by LogZ.LogWith as is. DTOs are written directly into the payload
+             without intermediate strings.
+             Keys are written as is and must be JSON-safe, empty keys and
+             empty strings are skipped same as in map based LogZ.Log.
+*/
+class LogZ_Payload
+{
+	protected ref LogZ_JsonWriter m_Writer = new LogZ_JsonWriter();
+	protected int m_Count;
+
+	/**
+	    \brief Drop all fields for reuse.
+	*/
+	void Reset()
+	{
+		m_Writer.Reset();
+		m_Count = 0;
+	}
+
+	/**
+	    \brief Number of written fields.
+	*/
+	int Count()
+	{
+		return m_Count;
+	}
+
+	/**
+	    \brief Written fields as comma separated "key":value pairs.
+	*/
+	string GetFields()
+	{
+		return m_Writer.GetJson();
+	}
+
+	void AddString(string key, string value)
+	{
+		if (key == string.Empty || value == string.Empty)
+			return;
+
+		m_Writer.AddString(key, value);
+		m_Count++;
+	}
+
+	void AddInt(string key, int value)
+	{
+		if (key == string.Empty)
+			return;
+
+		m_Writer.AddInt(key, value);
+		m_Count++;
+	}
+
+	/**
+	    \param decimals Digits after point, -1 uses float precision.
+	*/
+	void AddFloat(string key, float value, int decimals = -1)
+	{
+		if (key == string.Empty)
+			return;
+
+		m_Writer.AddFloat(key, value, decimals);
+		m_Count++;
+	}
+
+	void AddBool(string key, bool value)
+	{
+		if (key == string.Empty)
+			return;
+
+		m_Writer.AddBool(key, value);
+		m_Count++;
+	}
+
+	/**
+	    \param decimals Digits after point, -1 uses float precision.
+	*/
+	void AddVector(string key, vector value, int decimals = -1)
+	{
+		if (key == string.Empty)
+			return;
+
+		m_Writer.AddVector(key, value, decimals);
+		m_Count++;
+	}
+
+	/**
+	    \brief Add already serialized JSON value (object, array, number) as is.
+	*/
+	void AddRawJson(string key, string json)
+	{
+		if (key == string.Empty || json == string.Empty)
+			return;
+
+		m_Writer.AddRaw(key, json);
+		m_Count++;
+	}
+
+	/**
+	    \brief Write DTO as nested object, null DTO is skipped.
+	*/
+	void AddObject(string key, LogZ_DTO_Base dto)
+	{
+		if (key == string.Empty || !dto)
+			return;
+
+		dto.Write(m_Writer, key);
+		m_Count++;
+	}
+}
+#endif
@@ -6,26 +6,217 @@
 
 #ifdef SERVER
 /**
-    \brief Manages log output to file with buffering and time-based flushing.
+    \brief Sink behavior when buffered bytes reach max_pending_bytes.
 */
-class LogZ_Sink
+enum LogZ_SinkOverflow {
+	BLOCK, // write everything to disk synchronously
+	DROP_NEWEST, // drop incoming line
+	DROP_OLDEST, // drop oldest buffered lines
+	DROP_BELOW // drop incoming line below overflow_level, block otherwise
+}
+
+/**
+    \brief Chunk of newline-terminated lines accumulated between flushes.
+    \details Keeps line end offsets and levels so the chunk can be drained
+             or dropped in parts without splitting lines.
+*/
+class LogZ_SinkBuffer
 {
-	private static ref LogZ_Sink s_Instance;
+	string m_Data;
+	int m_Lines;
+	int m_Bytes;
+	int m_Offset; // bytes already taken
+	int m_Cursor; // lines already taken
+	ref array<int> m_LineEnds;
+	ref array<int> m_LineLevels;
+
+	/**
+	    \brief Constructor
+	*/
+	void LogZ_SinkBuffer()
+	{
+		m_LineEnds = new array<int>();
+		m_LineLevels = new array<int>();
+	}
+
+	/**
+	    \brief Append line with trailing newline.
+	*/
+	void Append(string line, LogZ_Level lvl)
+	{
+		m_Data += line;
+		m_Data += "\n";
+		m_Lines++;
+		m_Bytes += line.Length() + 1;
+		m_LineEnds.Insert(m_Bytes);
+		m_LineLevels.Insert(lvl);
+	}
+
+	/**
+	    \brief Skip oldest not taken line.
+	    \return int Level of dropped line or -1 if nothing to drop.
+	*/
+	int DropFirst()
+	{
+		if (IsDrained())
+			return -1;
+
+		m_Offset = m_LineEnds[m_Cursor];
+		m_Cursor++;
+
+		return m_LineLevels[m_Cursor - 1];
+	}
+
+	/**
+	    \brief Drop taken and dropped data once it is at least half of the chunk.
+	    \details Keeps memory of a chunk which is never drained bounded by
+	             twice its pending bytes, amortized cost per dropped line is constant.
+	*/
+	void Compact()
+	{
+		if (m_Cursor == 0)
+			return;
+
+		if (IsDrained()) {
+			Clear();
+			return;
+		}
+
+		if (m_Offset * 2 < m_Bytes)
+			return;
+
+		ref array<int> lineEnds = new array<int>();
+		ref array<int> lineLevels = new array<int>();
+		for (int i = m_Cursor; i < m_Lines; ++i) {
+			lineEnds.Insert(m_LineEnds[i] - m_Offset);
+			lineLevels.Insert(m_LineLevels[i]);
+		}
+
+		m_Data = m_Data.Substring(m_Offset, m_Bytes - m_Offset);
+		m_LineEnds = lineEnds;
+		m_LineLevels = lineLevels;
+		m_Lines -= m_Cursor;
+		m_Bytes -= m_Offset;
+		m_Offset = 0;
+		m_Cursor = 0;
+	}
+
+	/**
+	    \brief Lines not taken yet.
+	*/
+	int PendingLines()
+	{
+		return m_Lines - m_Cursor;
+	}
+
+	/**
+	    \brief Bytes not taken yet.
+	*/
+	int Pending()
+	{
+		return m_Bytes - m_Offset;
+	}
+
+	/**
+	    \brief Check if all lines are taken.
+	*/
+	bool IsDrained()
+	{
+		return m_Cursor >= m_Lines;
+	}
+
+	/**
+	    \brief Take next whole lines up to budget bytes.
+	    \details At least one line is taken even if it exceeds the budget.
+	    \param budget Max bytes to take, 0 or less takes all remaining lines.
+	*/
+	string Take(int budget)
+	{
+		if (IsDrained())
+			return string.Empty;
+
+		int end;
+		if (budget <= 0)
+			m_Cursor = m_Lines;
+		else {
+			int limit = m_Offset + budget;
+			m_Cursor++;
+			while (m_Cursor < m_Lines && m_LineEnds[m_Cursor] <= limit)
+				m_Cursor++;
+		}
+
+		end = m_LineEnds[m_Cursor - 1];
+
+		string chunk;
+		if (m_Offset == 0 && end == m_Bytes)
+			chunk = m_Data;
+		else
+			chunk = m_Data.Substring(m_Offset, end - m_Offset);
+
+		m_Offset = end;
+
+		return chunk;
+	}
 
-	private FileHandle m_FH;
-	private ref array<string> m_Buffer;
-	private int m_BufferSize;
-	private int m_FlushIntervalMs;
-	private int m_LastFlushTime;
-	private bool m_IsDirect;
-	private bool m_IsShutdown;
+	/**
+	    \brief Drop accumulated data.
+	*/
+	void Clear()
+	{
+		m_Data = string.Empty;
+		m_Lines = 0;
+		m_Bytes = 0;
+		m_Offset = 0;
+		m_Cursor = 0;
+		m_LineEnds.Clear();
+		m_LineLevels.Clear();
+	}
+}
+
+/**
+    \brief Manages log output to file with buffering, time-based flushing and size-based rotation.
+    \details Double-buffered: lines are appended to the front chunk, flush swaps
+             front and back and writes the back chunk. With incremental flush
+             enabled the back chunk is drained on the call queue at most
+             flush_frame_bytes per frame, synchronous flush is used only when
+             pending bytes reach max_pending_bytes (by overflow_policy) or on shutdown.
+             Size-based rotation and switching of time-windowed segments happen
+             between written chunks, so lines are never split and buffered lines
+             go to the new file.
+*/
+class LogZ_Sink : Managed
+{
+	protected static ref LogZ_Sink s_Instance;
+
+	protected FileHandle m_FH;
+	protected ref LogZ_ConfigDTO_File m_Config;
+	protected int m_FileBytes; // written to current file since open
+	protected int m_MaxFileBytes;
+	protected int m_SegmentSeconds;
+	protected int m_SegmentEnd; // epoch seconds when current segment ends
+	protected ref LogZ_SinkBuffer m_Front; // accepts new lines
+	protected ref LogZ_SinkBuffer m_Back; // written on flush
+	protected int m_BufferSize;
+	protected int m_BufferBytes;
+	protected int m_FrameBytes;
+	protected int m_MaxPendingBytes;
+	protected LogZ_SinkOverflow m_OverflowPolicy;
+	protected LogZ_Level m_OverflowLevel;
+	protected LogZ_Level m_FlushLevel;
+	protected int m_DroppedLines;
+	protected int m_FlushIntervalMs;
+	protected int m_LastFlushTime;
+	protected bool m_IsDirect;
+	protected bool m_IsDraining;
+	protected bool m_IsShutdown;
 
 	/**
 	    \brief Constructor
 	*/
 	void LogZ_Sink()
 	{
-		m_Buffer = new array<string>();
+		m_Front = new LogZ_SinkBuffer();
+		m_Back = new LogZ_SinkBuffer();
 	}
 
 	/**
@@ -48,11 +239,12 @@ class LogZ_Sink
 	}
 
 	/**
-	    \brief Initialize the sink using global configuration.
+	    \brief Initialize the sink using file configuration.
+	    \param cfgFile Resolved file config, global `file` when null.
 	*/
-	void Init()
+	void Init(LogZ_ConfigDTO_File cfgFile = null)
 	{
-		if (m_FH)
+		if (IsOpen())
 			Close();
 
 		if (!LogZ_Config.IsLoaded()) {
@@ -60,99 +252,395 @@ class LogZ_Sink
 			return;
 		}
 
-		LogZ_ConfigDTO_File cfgFile = LogZ_Config.Get().file;
+		if (!cfgFile)
+			cfgFile = LogZ_Config.Get().file;
+
+		m_Config = cfgFile;
 
 		// Setup
 		m_BufferSize = cfgFile.buffer_size;
+		m_BufferBytes = cfgFile.buffer_bytes;
+		m_FrameBytes = cfgFile.flush_frame_bytes;
+		m_MaxPendingBytes = cfgFile.max_pending_bytes;
+		m_OverflowPolicy = cfgFile.overflow_policy_enum;
+		m_OverflowLevel = cfgFile.overflow_level_enum;
+		m_FlushLevel = cfgFile.flush_level_enum;
+		m_DroppedLines = 0;
 		m_FlushIntervalMs = cfgFile.flush_interval * 1000;
+		m_MaxFileBytes = cfgFile.max_file_bytes;
+		m_SegmentSeconds = cfgFile.segment_seconds;
+		m_FileBytes = 0;
 		m_IsDirect = (m_BufferSize <= 0);
+		m_IsDraining = false;
 		m_IsShutdown = false;
 		m_LastFlushTime = g_Game.GetTime();
 
-		// Open file
-		FileMode mode = FileMode.WRITE;
-		if (cfgFile.append)
-			mode = FileMode.APPEND;
-
-		m_FH = OpenFile(cfgFile.full_path, mode);
-		if (!m_FH) {
-			ErrorEx("LogZ: Failed to open log file: " + cfgFile.full_path, ErrorExSeverity.ERROR);
+		if (!OpenOutput())
 			return;
-		}
 
-		// Setup buffer and timer
-		if (!m_IsDirect) {
-			m_Buffer.Reserve(m_BufferSize);
+		// Setup timer
+		if (!m_IsDirect)
 			g_Game.GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(OnTimerTick, m_FlushIntervalMs, true);
-		}
 	}
 
 	/**
 	    \brief Accepts a raw JSON line string.
+	    \param line Serialized line without newline.
+	    \param lvl  Line level, used by overflow policy and priority flush.
 	*/
-	void Write(string line)
+	void Write(string line, LogZ_Level lvl = LogZ_Level.INFO)
 	{
-		if (!m_FH)
+		if (!IsOpen())
 			return;
 
 		if (m_IsDirect || m_IsShutdown) {
-			FPrintln(m_FH, line);
+			WriteChunk(line + "\n");
+			return;
+		}
+
+		int lineBytes = line.Length() + 1;
+		if (m_MaxPendingBytes > 0 && PendingBytes() + lineBytes > m_MaxPendingBytes) {
+			if (!Overflow(lineBytes, lvl)) {
+				OnDropped(lvl);
+				return;
+			}
+		}
+
+		m_Front.Append(line, lvl);
 
 #ifdef METRICZ
-			LogZ.MetricBytesAdd(line.Length());
+		LogZ.MetricBufferBytesUpdate();
 #endif
 
+		if (lvl >= m_FlushLevel) {
+#ifdef DIAG
+			ErrorEx("LogZ: [Sink] Flush triggered by LEVEL (" + LogZ_Levels.ToString(lvl) + ")", ErrorExSeverity.INFO);
+#endif
+			Flush();
 			return;
 		}
 
-		m_Buffer.Insert(line);
+		if (m_Front.PendingLines() >= m_BufferSize) {
+#ifdef DIAG
+			ErrorEx("LogZ: [Sink] Flush triggered by BUFFER LIMIT (" + m_Front.PendingLines() + "/" + m_BufferSize + ")", ErrorExSeverity.INFO);
+#endif
+			ScheduleFlush();
+			return;
+		}
 
-		if (m_Buffer.Count() >= m_BufferSize) {
+		if (m_BufferBytes > 0 && m_Front.Pending() >= m_BufferBytes) {
 #ifdef DIAG
-			ErrorEx("LogZ: [Sink] Flush triggered by BUFFER LIMIT (" + m_Buffer.Count() + "/" + m_BufferSize + ")", ErrorExSeverity.INFO);
+			ErrorEx("LogZ: [Sink] Flush triggered by BYTES LIMIT (" + m_Front.Pending() + "/" + m_BufferBytes + ")", ErrorExSeverity.INFO);
 #endif
-			Flush();
+			ScheduleFlush();
 		}
 	}
 
 	/**
 	    \brief Forces a write of the current buffer to disk.
+	    \details Writes the rest of a chunk being drained first to keep lines order.
 	*/
 	void Flush()
 	{
 		// Reset timer even if empty to prevent double-checks
 		m_LastFlushTime = g_Game.GetTime();
 
-		if (!m_FH || m_Buffer.Count() == 0)
+		if (!IsOpen())
+			return;
+
+		if (!m_Back.IsDrained())
+			DrainBack(0);
+
+		if (m_Front.IsDrained())
 			return;
 
-		string chunk = "";
-		int count = m_Buffer.Count();
+		SwapBuffers();
+		DrainBack(0);
+	}
 
-		for (int i = 0; i < count; ++i)
-			chunk += string.Format("%1\n", m_Buffer[i]);
+	/**
+	    \brief Total bytes buffered and not written yet.
+	*/
+	int PendingBytes()
+	{
+		return m_Front.Pending() + m_Back.Pending();
+	}
 
-		FPrint(m_FH, chunk);
+	/**
+	    \brief Apply overflow policy before buffering a line over max_pending_bytes.
+	    \param bytes Incoming line size.
+	    \param lvl   Incoming line level.
+	    \return bool True if incoming line should be buffered, false if it is dropped.
+	*/
+	protected bool Overflow(int bytes, LogZ_Level lvl)
+	{
+		switch (m_OverflowPolicy) {
+		case LogZ_SinkOverflow.DROP_NEWEST:
+			return false;
+
+		case LogZ_SinkOverflow.DROP_BELOW:
+			if (lvl < m_OverflowLevel)
+				return false;
+
+			break;
+
+		case LogZ_SinkOverflow.DROP_OLDEST:
+			while (PendingBytes() + bytes > m_MaxPendingBytes) {
+				int dropped = m_Back.DropFirst();
+				if (dropped < 0)
+					dropped = m_Front.DropFirst();
+				if (dropped < 0)
+					break;
+
+				OnDropped(dropped);
+			}
+
+			// dropped lines must not keep memory
+			m_Back.Compact();
+			m_Front.Compact();
+
+			return true;
+		}
+
+#ifdef DIAG
+		ErrorEx("LogZ: [Sink] Flush triggered by HARD LIMIT (" + PendingBytes() + "/" + m_MaxPendingBytes + ")", ErrorExSeverity.INFO);
+#endif
+		Flush();
+
+		return true;
+	}
+
+	/**
+	    \brief Account dropped line.
+	*/
+	protected void OnDropped(int lvl)
+	{
+		m_DroppedLines++;
+
+#ifdef METRICZ
+		LogZ.MetricDroppedInc(lvl);
+#endif
+	}
+
+	/**
+	    \brief Flush incrementally on the call queue or synchronously if disabled.
+	*/
+	protected void ScheduleFlush()
+	{
+		m_LastFlushTime = g_Game.GetTime();
+
+		if (m_FrameBytes <= 0) {
+			Flush();
+			return;
+		}
+
+		// previous chunk still draining, front keeps accumulating until it is done
+		if (m_IsDraining)
+			return;
+
+		if (m_Front.IsDrained())
+			return;
+
+		SwapBuffers();
+		m_IsDraining = true;
+		g_Game.GetCallQueue(CALL_CATEGORY_SYSTEM).Call(OnDrainTick);
+	}
+
+	/**
+	    \brief Per-frame drain callback, writes at most flush_frame_bytes.
+	*/
+	protected void OnDrainTick()
+	{
+		m_IsDraining = false;
+
+		if (!IsOpen() || m_Back.IsDrained())
+			return;
+
+		DrainBack(m_FrameBytes);
+
+		if (!m_Back.IsDrained()) {
+			m_IsDraining = true;
+			g_Game.GetCallQueue(CALL_CATEGORY_SYSTEM).Call(OnDrainTick);
+			return;
+		}
+
+		// front reached a limit while back was draining
+		if (m_Front.PendingLines() >= m_BufferSize || (m_BufferBytes > 0 && m_Front.Pending() >= m_BufferBytes))
+			ScheduleFlush();
+	}
+
+	/**
+	    \brief Write next part of back chunk, clear it when drained.
+	    \param budget Max bytes to write, 0 writes all.
+	*/
+	protected void DrainBack(int budget)
+	{
+		WriteChunk(m_Back.Take(budget));
+
+		if (!m_Back.IsDrained())
+			return;
+
+		m_Back.Clear();
 
 #ifdef METRICZ
-		LogZ.MetricBytesAdd(chunk.Length());
 		LogZ.MetricFlushesInc();
+		LogZ.MetricBufferBytesUpdate();
+#endif
+	}
+
+	/**
+	    \brief Open log file, or current segment in time-windowed mode.
+	    \return bool True if output is ready for writes.
+	*/
+	protected bool OpenOutput()
+	{
+		if (m_SegmentSeconds > 0)
+			OpenSegment(LogZ_Time.EpochSecondsUTC());
+		else {
+			FileMode mode = FileMode.WRITE;
+			if (m_Config.append)
+				mode = FileMode.APPEND;
+
+			m_FH = OpenFile(m_Config.full_path, mode);
+		}
+
+		if (!m_FH) {
+			ErrorEx("LogZ: Failed to open log file: " + m_Config.full_path, ErrorExSeverity.ERROR);
+			return false;
+		}
+
+		return true;
+	}
+
+	/**
+	    \brief Output is open and accepts writes.
+	*/
+	protected bool IsOpen()
+	{
+		return m_FH != null;
+	}
+
+	/**
+	    \brief Write chunk of whole NDJSON lines to output.
+	    \details Switches segment before and rotates file after the write if needed.
+	    \param chunk One or more lines, each terminated by newline.
+	*/
+	protected void WriteChunk(string chunk)
+	{
+		CheckSegment();
+		if (!m_FH)
+			return;
+
+		FPrint(m_FH, chunk);
+		OnWritten(chunk.Length());
+	}
+
+	/**
+	    \brief Close output.
+	*/
+	protected void CloseOutput()
+	{
+		if (m_FH) {
+			CloseFile(m_FH);
+			m_FH = null;
+		}
+	}
+
+	/**
+	    \brief Account written bytes and rotate file when size limit is reached.
+	*/
+	protected void OnWritten(int bytes)
+	{
+#ifdef METRICZ
+		LogZ.MetricBytesAdd(bytes);
+#endif
+
+		m_FileBytes += bytes;
+		if (m_SegmentSeconds <= 0 && m_MaxFileBytes > 0 && m_FileBytes >= m_MaxFileBytes)
+			RotateFile();
+	}
+
+	/**
+	    \brief Switch to next time-windowed segment when current window is over.
+	*/
+	protected void CheckSegment()
+	{
+		if (m_SegmentSeconds <= 0)
+			return;
+
+		int now = LogZ_Time.EpochSecondsUTC();
+		if (now >= m_SegmentEnd)
+			OpenSegment(now);
+	}
+
+	/**
+	    \brief Close current file and open (append) segment for given time, prune expired segments.
+	*/
+	protected void OpenSegment(int epoch)
+	{
+		if (m_FH) {
+			CloseFile(m_FH);
+			m_FH = null;
+		}
+
+		m_SegmentEnd = epoch - (epoch % m_SegmentSeconds) + m_SegmentSeconds;
+		m_Config.full_path = LogZ_Rotation.SegmentPath(m_Config, epoch);
+		LogZ_Rotation.PruneSegments(m_Config, epoch);
+
+#ifdef DIAG
+		ErrorEx("LogZ: [Sink] Open segment " + m_Config.full_path, ErrorExSeverity.INFO);
+#endif
+
+		m_FileBytes = 0;
+		m_FH = OpenFile(m_Config.full_path, FileMode.APPEND);
+		if (!m_FH)
+			ErrorEx("LogZ: Failed to open log segment: " + m_Config.full_path, ErrorExSeverity.ERROR);
+	}
+
+	/**
+	    \brief Close current file and open the next generation.
+	    \details max_file_bytes implies generation rotation_mode, no log data is copied.
+	*/
+	protected void RotateFile()
+	{
+#ifdef DIAG
+		ErrorEx("LogZ: [Sink] Rotate triggered by FILE SIZE (" + m_FileBytes + "/" + m_MaxFileBytes + ")", ErrorExSeverity.INFO);
 #endif
 
-		m_Buffer.Clear();
+		int keep = m_Config.rotation_keep;
+		if (keep < 2)
+			keep = 2;
+
+		CloseFile(m_FH);
+		LogZ_Rotation.Rotate(m_Config, keep);
+
+		m_FileBytes = 0;
+		m_FH = OpenFile(m_Config.full_path, FileMode.WRITE);
+		if (!m_FH)
+			ErrorEx("LogZ: Failed to reopen log file after rotation: " + m_Config.full_path, ErrorExSeverity.ERROR);
+	}
+
+	/**
+	    \brief Swap front and back chunks, back must be drained.
+	*/
+	protected void SwapBuffers()
+	{
+		ref LogZ_SinkBuffer full = m_Front;
+		m_Front = m_Back;
+		m_Back = full;
 	}
 
 	/**
 	    \brief Background timer callback.
 	*/
-	private void OnTimerTick()
+	protected void OnTimerTick()
 	{
-		if (m_IsDirect || m_IsShutdown || !m_FH)
+		if (m_IsDirect || m_IsShutdown || !IsOpen())
 			return;
 
 		if ((g_Game.GetTime() - m_LastFlushTime) >= m_FlushIntervalMs) {
-			if (m_Buffer.Count() > 0) {
-				Flush();
+			if (!m_Front.IsDrained()) {
+				ScheduleFlush();
 #ifdef DIAG
 				ErrorEx("LogZ: [Sink] Flush triggered by TIMER (" + (g_Game.GetTime() - m_LastFlushTime) + "ms)", ErrorExSeverity.INFO);
 #endif
@@ -171,24 +659,25 @@ class LogZ_Sink
 
 		Flush();
 		g_Game.GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(OnTimerTick);
+		g_Game.GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(OnDrainTick);
+		m_IsDraining = false;
 		m_IsShutdown = true;
 
+		if (m_DroppedLines > 0)
+			ErrorEx("LogZ: sink dropped " + m_DroppedLines + " lines on buffer overflow", ErrorExSeverity.WARNING);
+
 #ifdef DIAG
 		ErrorEx("LogZ: [Sink] Flush triggered by SHUTDOWN", ErrorExSeverity.INFO);
 #endif
 	}
 
 	/**
-	    \brief Closes file handle.
+	    \brief Closes output.
 	*/
 	void Close()
 	{
 		Shutdown();
-
-		if (m_FH) {
-			CloseFile(m_FH);
-			m_FH = null;
-		}
+		CloseOutput();
 	}
 }
 #endif
@@ -15,11 +15,20 @@
 class LogZ_Geo
 {
 	static const float MAX_LAT = 85.05112878; //!< Web Mercator latitude clamp
+	static const int LAT_TABLE_SIZE = 2048; //!< Latitude table segments over map size, error well below 1 cm of world
 
 	// world / projection parameters
 	protected static float s_mapEffectiveSize; //!< Effective map size in world units
 	protected static float s_LongitudeScale; //!< Precomputed scale for longitude (360 / size)
 	protected static float s_MercatorScale; //!< Precomputed scale for Mercator Y ((2*PI) / size)
+	protected static float s_LatTableScale; //!< Precomputed scale for latitude table index (LAT_TABLE_SIZE / size)
+	protected static ref array<float> s_LatTable = new array<float>(); //!< Latitude by z, LAT_TABLE_SIZE + 1 points
+
+	// output settings
+	protected static int s_PosDecimals = -1; //!< Digits after point of world position
+	protected static int s_LonLatDecimals = -1; //!< Digits after point of lon/lat
+	protected static bool s_WithPos = true; //!< Write world position
+	protected static bool s_WithLonLat = true; //!< Write lon/lat
 
 	/**
 	    \brief Return effective map size in world units.
@@ -29,6 +38,38 @@ class LogZ_Geo
 		return s_mapEffectiveSize;
 	}
 
+	/**
+	    \brief Digits after point of world position in output.
+	*/
+	static int GetPosDecimals()
+	{
+		return s_PosDecimals;
+	}
+
+	/**
+	    \brief Digits after point of lon/lat in output.
+	*/
+	static int GetLonLatDecimals()
+	{
+		return s_LonLatDecimals;
+	}
+
+	/**
+	    \brief True if objects output world position.
+	*/
+	static bool WithPos()
+	{
+		return s_WithPos;
+	}
+
+	/**
+	    \brief True if objects output lon/lat.
+	*/
+	static bool WithLonLat()
+	{
+		return s_WithLonLat;
+	}
+
 	/**
 	    \brief Convert object world position to EPSG:4326 (WGS84).
 	    \param obj World object to sample position from.
@@ -66,10 +107,31 @@ class LogZ_Geo
 		// x: [0..size] -> lon: [-180..180]
 		lon = pos[0] * s_LongitudeScale - 180.0;
 
+		// z: [0..size] -> interpolated table point
+		float t = pos[2] * s_LatTableScale;
+		if (t >= 0 && t < LAT_TABLE_SIZE) {
+			int i = Math.Floor(t);
+			float a = s_LatTable[i];
+			lat = a + (s_LatTable[i + 1] - a) * (t - i);
+			return;
+		}
+
+		// outside of map bounds
+		lat = MercatorLat(pos[2]);
+	}
+
+	/**
+	    \brief Exact Web Mercator latitude of world z coordinate.
+	    \param z World z coordinate.
+	    \return float Latitude in degrees, clamped.
+	*/
+	static float MercatorLat(float z)
+	{
 		// z: [0..size] -> mercatorY: [-PI..PI]
-		float mercatorY = pos[2] * s_MercatorScale - Math.PI;
+		float mercatorY = z * s_MercatorScale - Math.PI;
 		float latRad = (2.0 * Math.Atan(Math.Pow(Math.EULER, mercatorY))) - (Math.PI * 0.5);
-		lat = Math.Clamp(latRad * Math.RAD2DEG, -MAX_LAT, MAX_LAT);
+
+		return Math.Clamp(latRad * Math.RAD2DEG, -MAX_LAT, MAX_LAT);
 	}
 
 	/**
@@ -80,18 +142,33 @@ class LogZ_Geo
 		if (!LogZ_Config.IsLoaded())
 			return;
 
+		LogZ_ConfigDTO_Geo cfg = LogZ_Config.Get().geo;
+		s_PosDecimals = cfg.precision;
+		s_LonLatDecimals = cfg.lonlat_precision;
+		s_WithPos = cfg.output_pos;
+		s_WithLonLat = cfg.output_lonlat;
+
 		// base world size from engine
 		s_mapEffectiveSize = g_Game.GetWorld().GetWorldSize();
 
 		// apply config override
-		if (LogZ_Config.Get().geo.world_effective_size_resolved > 0)
-			s_mapEffectiveSize = LogZ_Config.Get().geo.world_effective_size_resolved;
+		if (cfg.world_effective_size_resolved > 0)
+			s_mapEffectiveSize = cfg.world_effective_size_resolved;
 		if (s_mapEffectiveSize <= 0)
 			s_mapEffectiveSize = 15360;
 
 		// recompute scales after override
 		s_LongitudeScale = 360.0 / s_mapEffectiveSize;
 		s_MercatorScale = (2.0 * Math.PI) / s_mapEffectiveSize;
+
+		// latitude table over map bounds, float on the left keeps division in float
+		float tableSize = LAT_TABLE_SIZE;
+		s_LatTableScale = tableSize / s_mapEffectiveSize;
+		float step = s_mapEffectiveSize / tableSize;
+		s_LatTable.Clear();
+		s_LatTable.Reserve(LAT_TABLE_SIZE + 1);
+		for (int i = 0; i <= LAT_TABLE_SIZE; i++)
+			s_LatTable.Insert(MercatorLat(step * i));
 	}
 }
 #endif
@@ -10,39 +10,178 @@
 */
 class LogZ_Json
 {
+	// Significant decimal digits of float
+	static const int FLOAT_DIGITS = 7;
+	// Max digits after point in formatted float
+	static const int FLOAT_MAX_DECIMALS = 6;
+	// Powers of 10 up to FLOAT_MAX_DECIMALS
+	static const int POW10[7] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+	// Lowercase hex digits for \u00XX escapes
+	static const string HEX_DIGITS = "0123456789abcdef";
+	// Characters checked by Escape fast path
+	static const ref array<string> ESCAPE_NEEDLES = {"\"", "\\", "\n", "\r", "\t"};
+
+	/**
+	    \brief Format float as JSON number without exponent.
+	    \details Integral values keep ".0" suffix, trailing zeros of fraction are trimmed.
+	             NaN and infinity are written as 0.0 to keep the line valid JSON.
+	    \param value    Value to format.
+	    \param decimals Digits after point, -1 uses float precision (7 significant digits, up to 6 decimals).
+	    \return string JSON number.
+	*/
+	static string FormatFloat(float value, int decimals = -1)
+	{
+		// NaN has no JSON representation
+		if (value != value)
+			return "0.0";
+
+		string sign;
+		if (value < 0) {
+			sign = "-";
+			value = -value;
+		}
+
+		// infinity has no JSON representation too
+		if (value > float.MAX)
+			return "0.0";
+
+		// out of int range, precision is lost anyway
+		if (value >= 2000000000)
+			return sign + value.ToString();
+
+		int whole = Math.Floor(value);
+
+		if (decimals < 0) {
+			decimals = FLOAT_DIGITS - 1;
+			for (int pow = 10; pow <= whole && decimals > 0; pow *= 10)
+				decimals--;
+		} else if (decimals > FLOAT_MAX_DECIMALS)
+			decimals = FLOAT_MAX_DECIMALS;
+
+		int scale = POW10[decimals];
+		int frac = Math.Round((value - whole) * scale);
+		if (frac >= scale) {
+			whole++;
+			frac -= scale;
+		}
+
+		if (frac == 0) {
+			if (whole == 0)
+				return "0.0";
+
+			return sign + whole.ToString() + ".0";
+		}
+
+		string fraction = frac.ToStringLen(decimals);
+		int length = decimals;
+		while (length > 1 && fraction.Get(length - 1) == "0")
+			length--;
+
+		return sign + whole.ToString() + "." + fraction.Substring(0, length);
+	}
+
+	/**
+	    \brief Format vector as JSON array of 3 numbers.
+	    \param decimals Digits after point, -1 uses float precision.
+	*/
+	static string FormatVector(vector value, int decimals = -1)
+	{
+		return "[" + FormatFloat(value[0], decimals) + "," + FormatFloat(value[1], decimals) + "," + FormatFloat(value[2], decimals) + "]";
+	}
+
 	/**
 	    \brief Escape a string for safe JSON inclusion.
+	    \details Strings without quote, backslash, \n, \r and \t are detected with 5 native
+	             IndexOf calls and returned unchanged. Otherwise single pass over bytes,
+	             unescaped runs are copied with one Substring.
+	             Control characters without short escape are written as \u00XX, they are
+	             handled only in that pass (game strings do not contain them without
+	             one of the checked characters).
+	             Engine identifiers known to be JSON-safe are written with
+	             LogZ_JsonWriter.AddRawString and skip this call.
+	             UTF-8 multibyte sequences never contain bytes below 0x80 and are kept as is.
 	    \return string Escaped string (no surrounding quotes).
 	*/
 	static string Escape(string input)
 	{
-		if (!input || input == string.Empty)
-			return "";
+		int length = input.Length();
+		if (length == 0)
+			return string.Empty;
 
-		if (input.IndexOf("\"") == -1 && input.IndexOf("\\") == -1 && input.IndexOf("\n") == -1 && input.IndexOf("\r") == -1 && input.IndexOf("\t") == -1)
+		if (!NeedsEscape(input))
 			return input;
 
-		string result = "";
-		int n = input.LengthUtf8();
+		string result;
+		int runStart = 0;
 
-		for (int i = 0; i < n; ++i) {
-			string chars = input.SubstringUtf8(i, 1);
-			int ascii = chars.ToAscii();
+		for (int i = 0; i < length; ++i) {
+			int ascii = input.Get(i).ToAscii();
 
-			// ASCII specials
-			if (ascii == 34) { result += "\\"; result += "\""; continue; }
-			if (ascii == 92) { result += "\\"; result += "\\"; continue; }
-			if (ascii == 10) { result += "\\n"; continue; }
-			if (ascii == 13) { result += "\\r"; continue; }
-			if (ascii == 9) { result += "\\t"; continue; }
-			if (ascii >= 0 && ascii < 32) { result += " "; continue; }
+			// plain ASCII or UTF-8 byte (negative when char is signed)
+			if (ascii < 0 || (ascii >= 32 && ascii != 34 && ascii != 92))
+				continue;
+
+			if (i > runStart)
+				result += input.Substring(runStart, i - runStart);
 
-			result += chars; // keep UTF-8 as-is
+			result += EscapeChar(ascii);
+			runStart = i + 1;
 		}
 
+		// nothing to escape
+		if (runStart == 0)
+			return input;
+
+		if (runStart < length)
+			result += input.Substring(runStart, length - runStart);
+
 		return result;
 	}
 
+	/**
+	    \brief Check with native IndexOf if string contains a common character to escape.
+	*/
+	protected static bool NeedsEscape(string input)
+	{
+		foreach (string needle : ESCAPE_NEEDLES) {
+			if (input.IndexOf(needle) != -1)
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	    \brief JSON escape sequence for quote, backslash or control character.
+	*/
+	protected static string EscapeChar(int ascii)
+	{
+		switch (ascii) {
+		case 34:
+			return "\\\"";
+
+		case 92:
+			return "\\\\";
+
+		case 10:
+			return "\\n";
+
+		case 13:
+			return "\\r";
+
+		case 9:
+			return "\\t";
+
+		case 8:
+			return "\\b";
+
+		case 12:
+			return "\\f";
+		}
+
+		return "\\u00" + HEX_DIGITS.Get(ascii >> 4) + HEX_DIGITS.Get(ascii & 15);
+	}
+
 	/**
 	    \brief Heuristic check if string is a JSON value.
 	    \warning Stock JsonSerializer has no polymorphism or field injection.
@@ -0,0 +1,256 @@
+/*
+    SPDX-License-Identifier: GPL-3.0-or-later
+    Copyright (c) 2025 WoozyMasta
+    Source: https://github.com/woozymasta/logz
+*/
+
+#ifdef SERVER
+/**
+    \brief Streaming JSON writer appending typed values into one line.
+    \details Replaces JsonSerializer for log lines: no reflection, no intermediate
+             strings per nested DTO and no guessing of value types.
+             Commas are placed automatically. Keys are written as is and must be
+             JSON-safe, pass external keys through LogZ_Json.Escape.
+             Empty key writes a bare value, used for array elements and root object.
+             Opt* methods are Add* for optional fields, they skip zero, false and empty
+             values when omitempty is enabled (settings.compact).
+    \note    Writer does not validate nesting, Begin* and End* calls must be paired.
+*/
+class LogZ_JsonWriter
+{
+	// skip default values in Opt* methods (settings.compact)
+	protected static bool s_OmitEmpty;
+
+	protected string m_Json;
+	protected bool m_NeedComma;
+
+	/**
+	    \brief Enable omitempty mode of Opt* methods for all writers.
+	*/
+	static void SetOmitEmpty(bool omitEmpty)
+	{
+		s_OmitEmpty = omitEmpty;
+	}
+
+	/**
+	    \brief True if Opt* methods skip default values.
+	*/
+	static bool IsOmitEmpty()
+	{
+		return s_OmitEmpty;
+	}
+
+	/**
+	    \brief Clear written data for reuse.
+	*/
+	void Reset()
+	{
+		m_Json = string.Empty;
+		m_NeedComma = false;
+	}
+
+	/**
+	    \brief Written JSON.
+	*/
+	string GetJson()
+	{
+		return m_Json;
+	}
+
+	/**
+	    \brief Start object, optionally as value of key.
+	*/
+	void BeginObject(string key = string.Empty)
+	{
+		Next(key);
+		m_Json += "{";
+		m_NeedComma = false;
+	}
+
+	/**
+	    \brief Close current object.
+	*/
+	void EndObject()
+	{
+		m_Json += "}";
+		m_NeedComma = true;
+	}
+
+	/**
+	    \brief Start array, optionally as value of key.
+	*/
+	void BeginArray(string key = string.Empty)
+	{
+		Next(key);
+		m_Json += "[";
+		m_NeedComma = false;
+	}
+
+	/**
+	    \brief Close current array.
+	*/
+	void EndArray()
+	{
+		m_Json += "]";
+		m_NeedComma = true;
+	}
+
+	/**
+	    \brief Write escaped and quoted string value.
+	*/
+	void AddString(string key, string value)
+	{
+		Next(key);
+		m_Json += "\"" + LogZ_Json.Escape(value) + "\"";
+		m_NeedComma = true;
+	}
+
+	/**
+	    \brief Write quoted string value without escaping.
+	    \details For engine identifiers that never need escaping (class, type and
+	             event names), value must be JSON-safe.
+	*/
+	void AddRawString(string key, string value)
+	{
+		Next(key);
+		m_Json += "\"" + value + "\"";
+		m_NeedComma = true;
+	}
+
+	/**
+	    \brief Write integer value.
+	*/
+	void AddInt(string key, int value)
+	{
+		Next(key);
+		m_Json += value.ToString();
+		m_NeedComma = true;
+	}
+
+	/**
+	    \brief Write float value.
+	    \param decimals Digits after point, -1 uses float precision.
+	*/
+	void AddFloat(string key, float value, int decimals = -1)
+	{
+		Next(key);
+		m_Json += LogZ_Json.FormatFloat(value, decimals);
+		m_NeedComma = true;
+	}
+
+	/**
+	    \brief Write boolean value.
+	    \details Written as 1/0 same as JsonSerializer, keeps log schema unchanged.
+	*/
+	void AddBool(string key, bool value)
+	{
+		Next(key);
+		if (value)
+			m_Json += "1";
+		else
+			m_Json += "0";
+
+		m_NeedComma = true;
+	}
+
+	/**
+	    \brief Write vector as array of 3 numbers.
+	    \param decimals Digits after point, -1 uses float precision.
+	*/
+	void AddVector(string key, vector value, int decimals = -1)
+	{
+		Next(key);
+		m_Json += LogZ_Json.FormatVector(value, decimals);
+		m_NeedComma = true;
+	}
+
+	/**
+	    \brief Write optional string, skipped if empty in omitempty mode.
+	*/
+	void OptString(string key, string value)
+	{
+		if (s_OmitEmpty && value == string.Empty)
+			return;
+
+		AddString(key, value);
+	}
+
+	/**
+	    \brief Write optional JSON-safe string without escaping, skipped if empty in omitempty mode.
+	*/
+	void OptRawString(string key, string value)
+	{
+		if (s_OmitEmpty && value == string.Empty)
+			return;
+
+		AddRawString(key, value);
+	}
+
+	/**
+	    \brief Write optional integer, skipped if zero in omitempty mode.
+	*/
+	void OptInt(string key, int value)
+	{
+		if (s_OmitEmpty && value == 0)
+			return;
+
+		AddInt(key, value);
+	}
+
+	/**
+	    \brief Write optional float, skipped if zero in omitempty mode.
+	    \param decimals Digits after point, -1 uses float precision.
+	*/
+	void OptFloat(string key, float value, int decimals = -1)
+	{
+		if (s_OmitEmpty && value == 0)
+			return;
+
+		AddFloat(key, value, decimals);
+	}
+
+	/**
+	    \brief Write optional boolean, skipped if false in omitempty mode.
+	*/
+	void OptBool(string key, bool value)
+	{
+		if (s_OmitEmpty && !value)
+			return;
+
+		AddBool(key, value);
+	}
+
+	/**
+	    \brief Write already serialized JSON value as is.
+	*/
+	void AddRaw(string key, string json)
+	{
+		Next(key);
+		m_Json += json;
+		m_NeedComma = true;
+	}
+
+	/**
+	    \brief Append already serialized "key":value pairs into current object.
+	    \param fields One or more comma separated pairs, without braces.
+	*/
+	void AddFields(string fields)
+	{
+		Next(string.Empty);
+		m_Json += fields;
+		m_NeedComma = true;
+	}
+
+	/**
+	    \brief Write separator and key before next value.
+	*/
+	protected void Next(string key)
+	{
+		if (m_NeedComma)
+			m_Json += ",";
+
+		if (key != string.Empty)
+			m_Json += "\"" + key + "\":";
+	}
+}
+#endif
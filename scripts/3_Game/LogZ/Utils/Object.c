@@ -53,6 +53,18 @@ class LogZ_Object
 		"flat",
 	};
 
+	// lookup set of NAME_SUFFIXES, built on first use
+	protected static ref map<string, bool> s_Suffixes;
+
+	// raw type name -> name without suffix
+	protected static ref map<string, string> s_StrippedNames = new map<string, string>();
+
+	// model part of debug name ("path/name.p3d") -> normalized name
+	protected static ref map<string, string> s_ModelNames = new map<string, string>();
+
+	// config type name -> high-level type
+	protected static ref map<string, string> s_Types = new map<string, string>();
+
 	/**
 	    \brief Derive a readable object type/name.
 	    \param obj       Source object.
@@ -91,15 +103,23 @@ class LogZ_Object
 		if (dbg == string.Empty)
 			return "unknown";
 
-		array<string> parts = new array<string>();
-		dbg.Split(":", parts);
-
+		// "<id>: <path>.p3d", model part is shared by all instances and cached
 		string part;
-		if (parts.Count() == 2) {
-			if (parts[1].IndexOf(".p3d") > 0)
-				part = parts[1].Substring(0, parts[1].Length() - 4);
-			else
-				part = parts[0];
+		int sep = dbg.IndexOf(":");
+		if (sep >= 0 && dbg.LastIndexOf(":") == sep) {
+			string model = dbg.Substring(sep + 1, dbg.Length() - (sep + 1));
+			if (model.IndexOf(".p3d") > 0) {
+				if (s_ModelNames.Find(model, part))
+					return part;
+
+				part = model.Substring(0, model.Length() - 4);
+				part.TrimInPlace();
+				s_ModelNames.Set(model, part);
+
+				return part;
+			}
+
+			part = dbg.Substring(0, sep);
 		} else
 			part = dbg;
 
@@ -110,8 +130,30 @@ class LogZ_Object
 
 	/**
 	    \brief Map Object to high-level type string.
+	    \details Result of class level checks is cached per config type name.
+	             Holograms (per instance state) and map objects without type name
+	             are resolved on every call and never stored in the cache.
 	*/
 	static string GetType(Object obj)
+	{
+		string typeName = obj.GetType();
+		if (typeName == string.Empty || obj.IsHologram())
+			return ResolveType(obj);
+
+		string type;
+		if (s_Types.Find(typeName, type))
+			return type;
+
+		type = ResolveType(obj);
+		s_Types.Set(typeName, type);
+
+		return type;
+	}
+
+	/**
+	    \brief GetType without result cache.
+	*/
+	protected static string ResolveType(Object obj)
 	{
 		if (obj.IsTransport()) {
 			Transport veh = Transport.Cast(obj);
@@ -203,11 +245,25 @@ class LogZ_Object
 	}
 
 	/**
-	    \brief Generate stable hash from entity persistent ID.
+	    \brief Stable hash of entity persistent ID, cached on the entity.
 	    \param entity EntityAI reference.
-	    \return int Stable hash per persistent identity or per runtime for non-persistent.
+	    \return int Stable hash per persistent identity or per entity lifetime for non-persistent.
 	*/
 	static int PersistentHash(EntityAI entity)
+	{
+		if (!entity)
+			return 0;
+
+		return entity.LogZ_GetId();
+	}
+
+	/**
+	    \brief Generate hash from entity persistent ID.
+	    \details Non-persistent entities get random value on every call, use PersistentHash.
+	    \param entity EntityAI reference.
+	    \return int Hash per persistent identity or random for non-persistent.
+	*/
+	static int ComputePersistentHash(EntityAI entity)
 	{
 		if (!entity)
 			return 0;
@@ -215,11 +271,17 @@ class LogZ_Object
 		int p1, p2, p3, p4;
 		entity.GetPersistentID(p1, p2, p3, p4);
 
-		// Non-persistent objects assign random but consistent per runtime
+		int hash;
 		if (p1 == 0 && p2 == 0 && p3 == 0 && p4 == 0)
-			return string.Format("%1_%2", entity.GetType(), Math.RandomInt(1, int.MAX)).Hash();
+			hash = string.Format("%1_%2", entity.GetType(), Math.RandomInt(1, int.MAX)).Hash();
+		else
+			hash = string.Format("%1_%2_%3_%4", p1, p2, p3, p4).Hash();
 
-		return string.Format("%1_%2_%3_%4", p1, p2, p3, p4).Hash();
+		// 0 means "not computed" in cache
+		if (hash == 0)
+			hash = 1;
+
+		return hash;
 	}
 
 	/**
@@ -228,6 +290,21 @@ class LogZ_Object
 	    \return string Name without the last known suffix, or original name if nothing matches.
 	*/
 	static string StripSuffix(string name)
+	{
+		string stripped;
+		if (s_StrippedNames.Find(name, stripped))
+			return stripped;
+
+		stripped = StripSuffixUncached(name);
+		s_StrippedNames.Set(name, stripped);
+
+		return stripped;
+	}
+
+	/**
+	    \brief StripSuffix without result cache.
+	*/
+	protected static string StripSuffixUncached(string name)
 	{
 		name.TrimInPlace();
 		if (name == string.Empty)
@@ -241,11 +318,15 @@ class LogZ_Object
 		if (suffix == string.Empty)
 			return name;
 
-		for (int i = 0; i < NAME_SUFFIXES.Count(); ++i) {
-			if (suffix == NAME_SUFFIXES[i])
-				return name.Substring(0, sep);
+		if (!s_Suffixes) {
+			s_Suffixes = new map<string, bool>();
+			foreach (string known : NAME_SUFFIXES)
+				s_Suffixes.Set(known, true);
 		}
 
+		if (s_Suffixes.Contains(suffix))
+			return name.Substring(0, sep);
+
 		// generic <digits>rnd, e.g. 5rnd, 20rnd, 100rnd, 1000rnd...
 		int len = suffix.Length();
 		if (len > 3 && suffix.Substring(len - 3, 3) == "rnd") {
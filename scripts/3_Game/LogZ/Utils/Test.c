@@ -59,6 +59,17 @@ class LogZ_Test
 		m.Insert("a", "[1,2,3]");
 		LogZ.Fatal("test mixed", LogZ_Event.EXPLOSIVE, m);
 
+		LogZ_Payload payload = new LogZ_Payload();
+		payload.AddInt("int", 42);
+		payload.AddFloat("float", 3.1415);
+		payload.AddFloat("float_2", 3.1415, 2);
+		payload.AddBool("bool", true);
+		payload.AddVector("vector", pos);
+		payload.AddString("string", "hello \"world\"");
+		payload.AddString("empty", "");
+		payload.AddRawJson("raw", "{\"k\":[1,2]}");
+		LogZ.LogWith("test payload", LogZ_Level.INFO, LogZ_Event.SYSTEM_GAME, payload);
+
 		LogZ.Info("test wrong max event", LogZ_Event.MAX);
 		LogZ.Info("test wrong event", LogZ_Event.MAX + 1);
 
@@ -76,6 +87,72 @@ class LogZ_Test
 
 		settings.level_enum = oldLevel;
 		settings.events_mask_int = oldEvent;
+
+		RunGeo();
+
+#ifdef DIAG
+		RunSinkBuffer();
+#endif
+	}
+
+	/**
+	    \brief Check that interpolated latitude table matches exact Web Mercator latitude.
+	*/
+	static void RunGeo()
+	{
+		float size = LogZ_Geo.GetMapEffectiveSize();
+		if (size <= 0) {
+			ErrorEx("LogZ: [Test] geo not initialized", ErrorExSeverity.ERROR);
+			return;
+		}
+
+		array<float> fractions = {0.0, 0.1, 0.37, 0.5, 0.777, 0.93};
+		foreach (float fraction : fractions) {
+			vector pos = Vector(size * 0.5, 0, size * fraction);
+			float lon, lat;
+			LogZ_Geo.GetLonLat(pos, lon, lat);
+
+			float exact = LogZ_Geo.MercatorLat(pos[2]);
+			if (Math.AbsFloat(lat - exact) > 0.0001) {
+				ErrorEx("LogZ: [Test] geo lat FAILED at z=" + pos[2] + ": " + lat + " != " + exact, ErrorExSeverity.ERROR);
+				return;
+			}
+		}
+
+		ErrorEx("LogZ: [Test] geo lat ok", ErrorExSeverity.INFO);
 	}
+
+#ifdef DIAG
+	/**
+	    \brief Check that lines dropped from the front of a sink buffer free their memory.
+	*/
+	static void RunSinkBuffer()
+	{
+		LogZ_SinkBuffer buf = new LogZ_SinkBuffer();
+		buf.Append("aaaa", LogZ_Level.DEBUG); // 5 bytes
+		buf.Append("bbbbbb", LogZ_Level.INFO); // 7 bytes
+		buf.Append("cc", LogZ_Level.WARN); // 3 bytes
+
+		int dropped = buf.DropFirst();
+		dropped = buf.DropFirst();
+		buf.Compact();
+
+		bool ok = (dropped == LogZ_Level.INFO);
+		ok = ok && buf.m_Bytes == 3 && buf.Pending() == 3;
+		ok = ok && buf.m_Lines == 1 && buf.PendingLines() == 1;
+		ok = ok && buf.m_Data == "cc\n";
+		ok = ok && buf.Take(0) == "cc\n" && buf.IsDrained();
+
+		buf.Append("dd", LogZ_Level.INFO);
+		buf.DropFirst();
+		buf.Compact();
+		ok = ok && buf.m_Bytes == 0 && buf.m_Lines == 0 && buf.m_Data == string.Empty;
+
+		if (ok)
+			ErrorEx("LogZ: [Test] sink buffer drop ok", ErrorExSeverity.INFO);
+		else
+			ErrorEx("LogZ: [Test] sink buffer drop FAILED, bytes=" + buf.m_Bytes + " lines=" + buf.m_Lines, ErrorExSeverity.ERROR);
+	}
+#endif
 }
 #endif
@@ -20,6 +20,89 @@ class LogZ_Time
 	// Days per month in non-leap year
 	static const int MDAYS[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
 
+	// Clock cache, refreshed at most once per uptime tick
+	private static int s_ClockUptime = -1;
+	private static int s_ClockEpoch;
+	private static int s_ClockMillis;
+	private static int s_ClockGameEpoch;
+
+	// Recalibrate uptime to epoch offset every 60 s to follow wall clock drift
+	static const int CLOCK_CALIBRATE_INTERVAL_MS = 60000;
+	// Max uptime gap between two samples accepted as second boundary at once
+	static const int CLOCK_CALIBRATE_MAX_GAP_MS = 50;
+	// Second boundaries sampled before the smallest gap one is used (slow server frames)
+	static const int CLOCK_CALIBRATE_MAX_BOUNDARIES = 5;
+
+	// Calibrated offset: epoch second s_ClockBaseEpoch started at uptime s_ClockBaseUptime
+	private static int s_ClockBaseEpoch = -1;
+	private static int s_ClockBaseUptime;
+	// Calibration state, previous frame sample
+	private static bool s_ClockCalibrating;
+	private static int s_ClockSampleEpoch;
+	private static int s_ClockSampleUptime = -1;
+	// Calibration state, smallest gap boundary seen so far
+	private static int s_ClockBoundaries;
+	private static int s_ClockBestGap;
+	private static int s_ClockBestEpoch;
+	private static int s_ClockBestUptime;
+
+	/**
+	    \brief Cached EpochSecondsUTC, computed once per uptime tick.
+	    \details Lines logged in the same frame share one timestamp, use for hot paths.
+	             When millisecond clock is calibrated seconds are taken from it,
+	             so they always match ClockEpochMillisUTC.
+	*/
+	static int ClockEpochSecondsUTC()
+	{
+		UpdateClock();
+		return s_ClockEpoch;
+	}
+
+	/**
+	    \brief Cached GameEpochSeconds, computed once per uptime tick.
+	*/
+	static int ClockGameEpochSeconds()
+	{
+		UpdateClock();
+		return s_ClockGameEpoch;
+	}
+
+	/**
+	    \brief Cached UTC epoch time in milliseconds as JSON integer literal.
+	    \details Computed as uptime plus calibrated epoch offset (see StartClockCalibration),
+	             error is one calibration frame gap (max CLOCK_CALIBRATE_MAX_GAP_MS on servers
+	             running above 20 FPS, otherwise the smallest frame gap seen) plus uptime drift
+	             over CLOCK_CALIBRATE_INTERVAL_MS. Until first calibration milliseconds are "000".
+	             Seconds are the same as ClockEpochSecondsUTC.
+	             Returned as string, value exceeds 32-bit int.
+	    \return string e.g. "1763850873042".
+	*/
+	static string ClockEpochMillisUTC()
+	{
+		UpdateClock();
+		return s_ClockEpoch.ToString() + s_ClockMillis.ToStringLen(3);
+	}
+
+	/**
+	    \brief Start calibration of uptime to epoch millisecond offset.
+	    \details Samples wall clock every frame until epoch second changes between two
+	             consecutive frames, then stores uptime of that frame as the second boundary.
+	             Boundary is taken at once when frame gap is within CLOCK_CALIBRATE_MAX_GAP_MS,
+	             otherwise the smallest gap of CLOCK_CALIBRATE_MAX_BOUNDARIES boundaries is used.
+	             Repeats every CLOCK_CALIBRATE_INTERVAL_MS. No-op while calibration is running.
+	*/
+	static void StartClockCalibration()
+	{
+		if (s_ClockCalibrating)
+			return;
+
+		s_ClockCalibrating = true;
+		s_ClockSampleUptime = -1;
+		s_ClockBoundaries = 0;
+		s_ClockBestGap = int.MAX;
+		g_Game.GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(OnClockCalibrateTick, 0, true);
+	}
+
 	/**
 	    \brief Unix epoch seconds derived from in-game world date.
 	    \return int Epoch seconds (world time, minute precision).
@@ -46,6 +129,121 @@ class LogZ_Time
 		return EpochSecondsForDate(y, m, d, hh, mm, ss);
 	}
 
+	/**
+	    \brief UTC date stamp for epoch seconds.
+	    \param epoch    Epoch seconds.
+	    \param withHour When true append hour.
+	    \return string "YYYYMMDD" or "YYYYMMDDHH".
+	*/
+	static string DateStamp(int epoch, bool withHour = false)
+	{
+		int y, m, d, hh;
+		DateForEpochSeconds(epoch, y, m, d, hh);
+
+		string stamp = y.ToStringLen(4) + m.ToStringLen(2) + d.ToStringLen(2);
+		if (withHour)
+			stamp += hh.ToStringLen(2);
+
+		return stamp;
+	}
+
+	/**
+	    \brief Civil UTC date and hour for epoch seconds (Gregorian, days-to-civil).
+	*/
+	static void DateForEpochSeconds(int epoch, out int y, out int m, out int d, out int hh)
+	{
+		if (epoch < 0)
+			epoch = 0;
+
+		int days = epoch / 86400;
+		hh = (epoch % 86400) / 3600;
+
+		int z = days + 719468; // shift epoch to 0000-03-01
+		int era = z / 146097;
+		int doe = z - era * 146097;
+		int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+		int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+		int mp = (5 * doy + 2) / 153;
+
+		d = doy - (153 * mp + 2) / 5 + 1;
+		if (mp < 10)
+			m = mp + 3;
+		else
+			m = mp - 9;
+
+		y = yoe + era * 400;
+		if (m <= 2)
+			y++;
+	}
+
+	/**
+	    \brief Refresh clock cache when uptime has changed.
+	*/
+	private static void UpdateClock()
+	{
+		int uptime = g_Game.GetTime();
+		if (uptime == s_ClockUptime)
+			return;
+
+		s_ClockUptime = uptime;
+		s_ClockEpoch = EpochSecondsUTC();
+		s_ClockMillis = 0;
+		s_ClockGameEpoch = GameEpochSeconds();
+
+		if (s_ClockBaseEpoch < 0)
+			return;
+
+		int elapsed = uptime - s_ClockBaseUptime;
+		int epoch = s_ClockBaseEpoch + elapsed / 1000;
+
+		// wall clock jumped away from calibration
+		if (epoch < s_ClockEpoch - 1 || epoch > s_ClockEpoch + 1) {
+			StartClockCalibration();
+			return;
+		}
+
+		s_ClockEpoch = epoch;
+		s_ClockMillis = elapsed % 1000;
+	}
+
+	/**
+	    \brief Per-frame calibration sample, stops once second boundary is found.
+	*/
+	private static void OnClockCalibrateTick()
+	{
+		int uptime = g_Game.GetTime();
+		if (uptime == s_ClockSampleUptime)
+			return;
+
+		int epoch = EpochSecondsUTC();
+		int gap = uptime - s_ClockSampleUptime;
+		bool boundary = (s_ClockSampleUptime >= 0 && epoch != s_ClockSampleEpoch);
+
+		s_ClockSampleEpoch = epoch;
+		s_ClockSampleUptime = uptime;
+
+		if (!boundary)
+			return;
+
+		s_ClockBoundaries++;
+		if (gap < s_ClockBestGap) {
+			s_ClockBestGap = gap;
+			s_ClockBestEpoch = epoch;
+			s_ClockBestUptime = uptime;
+		}
+
+		if (gap <= CLOCK_CALIBRATE_MAX_GAP_MS || s_ClockBoundaries >= CLOCK_CALIBRATE_MAX_BOUNDARIES) {
+			s_ClockBaseEpoch = s_ClockBestEpoch;
+			s_ClockBaseUptime = s_ClockBestUptime;
+			s_ClockCalibrating = false;
+
+			ScriptCallQueue queue = g_Game.GetCallQueue(CALL_CATEGORY_SYSTEM);
+			queue.Remove(OnClockCalibrateTick);
+			queue.Remove(StartClockCalibration);
+			queue.CallLater(StartClockCalibration, CLOCK_CALIBRATE_INTERVAL_MS, false);
+		}
+	}
+
 	/**
 	    \brief Count leap years up to year-1 (Gregorian).
 	    \param year Target year
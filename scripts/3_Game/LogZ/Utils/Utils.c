@@ -52,11 +52,20 @@ class LogZ_Utils
 	    \details Returns "0" if any object is null.
 	*/
 	static string Distance(Object a, Object b)
+	{
+		return DistanceFloat(a, b).ToString();
+	}
+
+	/**
+	    \brief Distance between two objects in meters.
+	    \details Returns 0 if any object is null.
+	*/
+	static float DistanceFloat(Object a, Object b)
 	{
 		if (!a || !b)
-			return "0";
+			return 0;
 
-		return vector.Distance(a.GetPosition(), b.GetPosition()).ToString();
+		return vector.Distance(a.GetPosition(), b.GetPosition());
 	}
 
 	/**
@@ -8,7 +8,7 @@
 /**
     \brief Serializable view of ActionData for action logging.
 */
-class LogZ_DTO_ActionData
+class LogZ_DTO_ActionData : LogZ_DTO_Base
 {
 	string action;
 	int action_id;
@@ -27,6 +27,26 @@ class LogZ_DTO_ActionData
 	*/
 	void LogZ_DTO_ActionData(ActionData action_data)
 	{
+		Load(action_data);
+	}
+
+	override void Reset()
+	{
+		action = string.Empty;
+		action_id = 0;
+		recipe = string.Empty;
+		recipe_id = 0;
+		condition_mask = 0;
+		state = 0;
+	}
+
+	/**
+	    \brief Reset and populate all fields from ActionData, used to reuse DTO.
+	*/
+	void Load(ActionData action_data)
+	{
+		Reset();
+
 		if (!action_data)
 			return;
 
@@ -51,5 +71,15 @@ class LogZ_DTO_ActionData
 		// executed = action_data.m_WasExecuted;
 		// stopped = action_data.m_ReciveEndInput;
 	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		writer.AddRawString("action", action);
+		writer.AddInt("action_id", action_id);
+		writer.OptRawString("recipe", recipe);
+		writer.OptInt("recipe_id", recipe_id);
+		writer.OptInt("condition_mask", condition_mask);
+		writer.AddInt("state", state);
+	}
 }
 #endif
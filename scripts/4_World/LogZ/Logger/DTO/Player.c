@@ -13,6 +13,25 @@ class LogZ_DTO_Player : LogZ_DTO_ManStats
 	// Player-specific stats snapshot.
 	ref LogZ_DTO_PlayerStats stats;
 
+	// stats DTO kept between Reset calls
+	protected ref LogZ_DTO_PlayerStats m_Stats;
+
+	override void Reset()
+	{
+		super.Reset();
+
+		stats = null;
+	}
+
+	override void Load(Object obj)
+	{
+		Reset();
+		Fill(obj);
+		FillStats(obj);
+		FillMan(obj);
+		FillPlayer(obj);
+	}
+
 	/**
 	    \brief Populate player-specific stats if object is PlayerBase.
 	*/
@@ -22,7 +41,12 @@ class LogZ_DTO_Player : LogZ_DTO_ManStats
 		if (!Class.CastTo(player, obj))
 			return;
 
-		stats = new LogZ_DTO_PlayerStats(player);
+		if (!m_Stats)
+			m_Stats = new LogZ_DTO_PlayerStats(player);
+		else
+			m_Stats.Load(player);
+
+		stats = m_Stats;
 	}
 
 	/**
@@ -35,13 +59,21 @@ class LogZ_DTO_Player : LogZ_DTO_ManStats
 		FillMan(obj);
 		FillPlayer(obj);
 	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		super.WriteFields(writer);
+
+		if (stats)
+			stats.Write(writer, "stats");
+	}
 }
 
 /**
     \brief Build stats snapshot from PlayerBase.
     \param player Source PlayerBase.
 */
-class LogZ_DTO_PlayerStats
+class LogZ_DTO_PlayerStats : LogZ_DTO_Base
 {
 	string blood_type;
 	bool blood_type_visible;
@@ -76,41 +108,217 @@ class LogZ_DTO_PlayerStats
 	int players_killed;
 	int infected_killed;
 
+	// LogZ_PlayerStatsField bits of filled fields
+	protected int m_Mask;
+
 	void LogZ_DTO_PlayerStats(PlayerBase player)
 	{
+		Load(player);
+	}
+
+	override void Reset()
+	{
+		blood_type = string.Empty;
+		blood_type_visible = false;
+		bleeding_bits = 0;
+		blood_hands = 0;
+		agents = 0;
+		life_span = 0;
+		broken_leg = 0;
+		last_shaved = 0;
+		immunity_boost = false;
+		unconscious = false;
+		restrained = false;
+		third_person = false;
+		water = 0;
+		toxicity = 0;
+		energy = 0;
+		heat_comfort = 0;
+		tremor = 0;
+		diet = 0;
+		stamina = 0;
+		specialty = 0;
+		heat_buffer = 0;
+		playtime = 0;
+		distance = 0;
+		longest_survivor_hit = 0;
+		players_killed = 0;
+		infected_killed = 0;
+		m_Mask = 0;
+	}
+
+	/**
+	    \brief Reset and read stats enabled in `fields.player_stats`, used to reuse DTO.
+	*/
+	void Load(PlayerBase player)
+	{
+		Reset();
+
 		if (!player)
 			return;
 
-		bool _p; string _t;
-		blood_type = BloodTypes.GetBloodTypeName(player.GetStatBloodType().Get(), _t, _p);
-		blood_type_visible = player.HasBloodTypeVisible();
-		bleeding_bits = player.GetBleedingBits();
-		blood_hands = player.HasBloodyHandsEx();
-
-		agents = player.GetAgents();
-		life_span = player.GetLifeSpanState();
-		broken_leg = player.GetBrokenLegs();
-		last_shaved = player.GetLastShavedSeconds();
-		immunity_boost = player.m_ImmunityBoosted;
-		unconscious = player.IsUnconscious();
-		restrained = player.IsRestrained();
-		third_person = player.IsInThirdPerson();
-
-		water = player.GetStatWater().Get();
-		toxicity = player.GetStatToxicity().Get();
-		energy = player.GetStatEnergy().Get();
-		heat_comfort = player.GetStatHeatComfort().Get();
-		tremor = player.GetStatTremor().Get();
-		diet = player.GetStatDiet().Get();
-		stamina = player.GetStatStamina().Get();
-		specialty = player.GetStatSpecialty().Get();
-		heat_buffer = player.GetStatHeatBuffer().Get();
-
-		playtime = player.StatGet(AnalyticsManagerServer.STAT_PLAYTIME);
-		distance = player.StatGet(AnalyticsManagerServer.STAT_DISTANCE);
-		longest_survivor_hit = player.StatGet(AnalyticsManagerServer.STAT_LONGEST_SURVIVOR_HIT);
-		players_killed = player.StatGet(AnalyticsManagerServer.STAT_PLAYERS_KILLED);
-		infected_killed = player.StatGet(AnalyticsManagerServer.STAT_INFECTED_KILLED);
+		m_Mask = LogZ_Config.Get().fields.player_stats_mask;
+
+		if (m_Mask & LogZ_PlayerStatsField.BLOOD_TYPE) {
+			bool _p; string _t;
+			blood_type = BloodTypes.GetBloodTypeName(player.GetStatBloodType().Get(), _t, _p);
+		}
+
+		if (m_Mask & LogZ_PlayerStatsField.BLOOD_TYPE_VISIBLE)
+			blood_type_visible = player.HasBloodTypeVisible();
+
+		if (m_Mask & LogZ_PlayerStatsField.BLEEDING_BITS)
+			bleeding_bits = player.GetBleedingBits();
+
+		if (m_Mask & LogZ_PlayerStatsField.BLOOD_HANDS)
+			blood_hands = player.HasBloodyHandsEx();
+
+		if (m_Mask & LogZ_PlayerStatsField.AGENTS)
+			agents = player.GetAgents();
+
+		if (m_Mask & LogZ_PlayerStatsField.LIFE_SPAN)
+			life_span = player.GetLifeSpanState();
+
+		if (m_Mask & LogZ_PlayerStatsField.BROKEN_LEG)
+			broken_leg = player.GetBrokenLegs();
+
+		if (m_Mask & LogZ_PlayerStatsField.LAST_SHAVED)
+			last_shaved = player.GetLastShavedSeconds();
+
+		if (m_Mask & LogZ_PlayerStatsField.IMMUNITY_BOOST)
+			immunity_boost = player.m_ImmunityBoosted;
+
+		if (m_Mask & LogZ_PlayerStatsField.UNCONSCIOUS)
+			unconscious = player.IsUnconscious();
+
+		if (m_Mask & LogZ_PlayerStatsField.RESTRAINED)
+			restrained = player.IsRestrained();
+
+		if (m_Mask & LogZ_PlayerStatsField.THIRD_PERSON)
+			third_person = player.IsInThirdPerson();
+
+		if (m_Mask & LogZ_PlayerStatsField.WATER)
+			water = player.GetStatWater().Get();
+
+		if (m_Mask & LogZ_PlayerStatsField.TOXICITY)
+			toxicity = player.GetStatToxicity().Get();
+
+		if (m_Mask & LogZ_PlayerStatsField.ENERGY)
+			energy = player.GetStatEnergy().Get();
+
+		if (m_Mask & LogZ_PlayerStatsField.HEAT_COMFORT)
+			heat_comfort = player.GetStatHeatComfort().Get();
+
+		if (m_Mask & LogZ_PlayerStatsField.TREMOR)
+			tremor = player.GetStatTremor().Get();
+
+		if (m_Mask & LogZ_PlayerStatsField.DIET)
+			diet = player.GetStatDiet().Get();
+
+		if (m_Mask & LogZ_PlayerStatsField.STAMINA)
+			stamina = player.GetStatStamina().Get();
+
+		if (m_Mask & LogZ_PlayerStatsField.SPECIALTY)
+			specialty = player.GetStatSpecialty().Get();
+
+		if (m_Mask & LogZ_PlayerStatsField.HEAT_BUFFER)
+			heat_buffer = player.GetStatHeatBuffer().Get();
+
+		if (m_Mask & LogZ_PlayerStatsField.PLAYTIME)
+			playtime = player.StatGet(AnalyticsManagerServer.STAT_PLAYTIME);
+
+		if (m_Mask & LogZ_PlayerStatsField.DISTANCE)
+			distance = player.StatGet(AnalyticsManagerServer.STAT_DISTANCE);
+
+		if (m_Mask & LogZ_PlayerStatsField.LONGEST_SURVIVOR_HIT)
+			longest_survivor_hit = player.StatGet(AnalyticsManagerServer.STAT_LONGEST_SURVIVOR_HIT);
+
+		if (m_Mask & LogZ_PlayerStatsField.PLAYERS_KILLED)
+			players_killed = player.StatGet(AnalyticsManagerServer.STAT_PLAYERS_KILLED);
+
+		if (m_Mask & LogZ_PlayerStatsField.INFECTED_KILLED)
+			infected_killed = player.StatGet(AnalyticsManagerServer.STAT_INFECTED_KILLED);
+	}
+
+	override void WriteFields(LogZ_JsonWriter writer)
+	{
+		if (m_Mask & LogZ_PlayerStatsField.BLOOD_TYPE)
+			writer.OptRawString("blood_type", blood_type);
+
+		if (m_Mask & LogZ_PlayerStatsField.BLOOD_TYPE_VISIBLE)
+			writer.OptBool("blood_type_visible", blood_type_visible);
+
+		if (m_Mask & LogZ_PlayerStatsField.BLEEDING_BITS)
+			writer.OptInt("bleeding_bits", bleeding_bits);
+
+		if (m_Mask & LogZ_PlayerStatsField.BLOOD_HANDS)
+			writer.OptInt("blood_hands", blood_hands);
+
+		if (m_Mask & LogZ_PlayerStatsField.AGENTS)
+			writer.OptInt("agents", agents);
+
+		if (m_Mask & LogZ_PlayerStatsField.LIFE_SPAN)
+			writer.OptInt("life_span", life_span);
+
+		if (m_Mask & LogZ_PlayerStatsField.BROKEN_LEG)
+			writer.OptInt("broken_leg", broken_leg);
+
+		if (m_Mask & LogZ_PlayerStatsField.LAST_SHAVED)
+			writer.OptInt("last_shaved", last_shaved);
+
+		if (m_Mask & LogZ_PlayerStatsField.IMMUNITY_BOOST)
+			writer.OptBool("immunity_boost", immunity_boost);
+
+		if (m_Mask & LogZ_PlayerStatsField.UNCONSCIOUS)
+			writer.OptBool("unconscious", unconscious);
+
+		if (m_Mask & LogZ_PlayerStatsField.RESTRAINED)
+			writer.OptBool("restrained", restrained);
+
+		if (m_Mask & LogZ_PlayerStatsField.THIRD_PERSON)
+			writer.OptBool("third_person", third_person);
+
+		if (m_Mask & LogZ_PlayerStatsField.WATER)
+			writer.OptFloat("water", water);
+
+		if (m_Mask & LogZ_PlayerStatsField.TOXICITY)
+			writer.OptFloat("toxicity", toxicity);
+
+		if (m_Mask & LogZ_PlayerStatsField.ENERGY)
+			writer.OptFloat("energy", energy);
+
+		if (m_Mask & LogZ_PlayerStatsField.HEAT_COMFORT)
+			writer.OptFloat("heat_comfort", heat_comfort);
+
+		if (m_Mask & LogZ_PlayerStatsField.TREMOR)
+			writer.OptFloat("tremor", tremor);
+
+		if (m_Mask & LogZ_PlayerStatsField.DIET)
+			writer.OptFloat("diet", diet);
+
+		if (m_Mask & LogZ_PlayerStatsField.STAMINA)
+			writer.OptFloat("stamina", stamina);
+
+		if (m_Mask & LogZ_PlayerStatsField.SPECIALTY)
+			writer.OptFloat("specialty", specialty);
+
+		if (m_Mask & LogZ_PlayerStatsField.HEAT_BUFFER)
+			writer.OptFloat("heat_buffer", heat_buffer);
+
+		if (m_Mask & LogZ_PlayerStatsField.PLAYTIME)
+			writer.OptFloat("playtime", playtime);
+
+		if (m_Mask & LogZ_PlayerStatsField.DISTANCE)
+			writer.OptFloat("distance", distance);
+
+		if (m_Mask & LogZ_PlayerStatsField.LONGEST_SURVIVOR_HIT)
+			writer.OptFloat("longest_survivor_hit", longest_survivor_hit);
+
+		if (m_Mask & LogZ_PlayerStatsField.PLAYERS_KILLED)
+			writer.OptInt("players_killed", players_killed);
+
+		if (m_Mask & LogZ_PlayerStatsField.INFECTED_KILLED)
+			writer.OptInt("infected_killed", infected_killed);
 	}
 }
 #endif
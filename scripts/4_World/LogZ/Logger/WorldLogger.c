@@ -10,6 +10,15 @@
 */
 class LogZ_WorldLogger
 {
+	// victim config type name -> hit event type
+	protected static ref map<string, int> s_VictimHitEvents = new map<string, int>();
+
+	// Reused payload and DTOs, loaded right before writing
+	protected static ref LogZ_Payload s_Payload = new LogZ_Payload();
+	protected static ref LogZ_DTO_Player s_Player = new LogZ_DTO_Player(null);
+	protected static ref LogZ_DTO_Damage s_Damage = new LogZ_DTO_Damage(null, 0, string.Empty, string.Empty);
+	protected static ref LogZ_DTO_ActionData s_ActionData = new LogZ_DTO_ActionData(null);
+
 	/**
 	    \brief Log full player snapshot with optional message.
 	    \param player    PlayerBase subject.
@@ -25,14 +34,12 @@ class LogZ_WorldLogger
 		if (msg == string.Empty)
 			msg = player.ClassName();
 
-		ref map<string, string> dto = new map<string, string>();
-		string json;
+		LogZ_Payload payload = s_Payload;
+		payload.Reset();
+		s_Player.Load(player);
+		payload.AddObject("player", s_Player);
 
-		LogZ_DTO_Player playerDTO = new LogZ_DTO_Player(player);
-		if (LogZ.GetSerializer().WriteToString(playerDTO, false, json))
-			dto.Insert("player", json);
-
-		LogZ.Log(msg, lvl, eventType, dto);
+		LogZ.LogWith(msg, lvl, eventType, payload);
 	}
 
 	/**
@@ -53,36 +60,29 @@ class LogZ_WorldLogger
 		if (!LogZ_Events.IsEnabled(eventType))
 			return;
 
-		ref map<string, string> dto = new map<string, string>();
-		string json;
-
-		if (LogZ_GameLogger.SerializeObject(victim, json))
-			dto.Insert("victim", json);
+		LogZ_Payload payload = s_Payload;
+		payload.Reset();
 
-		if (LogZ_GameLogger.SerializeParentObject(victim, json))
-			dto.Insert("victim_parent", json);
+		// victim changes with every hit, parent and attacker are rendered once per frame
+		LogZ_GameLogger.AddObject(payload, "victim", victim);
+		LogZ_GameLogger.AddParentObjectCached(payload, "victim_parent", victim);
 
 		if (!killer) {
-			LogZ.Log(string.Format("%1 died", LogZ_Object.GetType(victim)), lvl, eventType, dto);
+			LogZ.LogWith(string.Format("%1 died", LogZ_Object.GetType(victim)), lvl, eventType, payload);
 			return;
 		}
 
 		if (killer == victim) {
-			LogZ.Log(string.Format("%1 death or suicide", LogZ_Object.GetType(victim)), lvl, eventType, dto);
+			LogZ.LogWith(string.Format("%1 death or suicide", LogZ_Object.GetType(victim)), lvl, eventType, payload);
 			return;
 		}
 
-		dto.Insert("distance", LogZ_Utils.Distance(killer, victim));
+		payload.AddFloat("distance", LogZ_Utils.DistanceFloat(killer, victim));
 
-		EntityAI killerEntity = EntityAI.Cast(killer);
+		LogZ_GameLogger.AddObjectCached(payload, "attacker", killer);
+		LogZ_GameLogger.AddParentObjectCached(payload, "attacker_parent", killer);
 
-		if (LogZ_GameLogger.SerializeObject(killer, json))
-			dto.Insert("attacker", json);
-
-		if (LogZ_GameLogger.SerializeParentObject(killer, json))
-			dto.Insert("attacker_parent", json);
-
-		LogZ.Log(string.Format("%1 killed", LogZ_Object.GetType(victim)), lvl, eventType, dto);
+		LogZ.LogWith(string.Format("%1 killed", LogZ_Object.GetType(victim)), lvl, eventType, payload);
 	}
 
 	/**
@@ -113,38 +113,31 @@ class LogZ_WorldLogger
 				return;
 		}
 
-		ref map<string, string> dto = new map<string, string>();
-		string json;
-
-		if (LogZ_GameLogger.SerializeObject(victim, json))
-			dto.Insert("victim", json);
+		LogZ_Payload payload = s_Payload;
+		payload.Reset();
 
-		if (LogZ_GameLogger.SerializeParentObject(victim, json))
-			dto.Insert("victim_parent", json);
-
-		LogZ_DTO_Damage damageDTO = new LogZ_DTO_Damage(damageResult, damageType, dmgZone, ammo);
-		if (LogZ.GetSerializer().WriteToString(damageDTO, false, json))
-			dto.Insert("damage", json);
+		// victim changes with every hit, parent and attacker are rendered once per frame
+		LogZ_GameLogger.AddObject(payload, "victim", victim);
+		LogZ_GameLogger.AddParentObjectCached(payload, "victim_parent", victim);
+		s_Damage.Load(damageResult, damageType, dmgZone, ammo);
+		payload.AddObject("damage", s_Damage);
 
 		if (!source) {
-			LogZ.Log(string.Format("%1 damaged", LogZ_Object.GetType(victim)), lvl, eventType, dto);
+			LogZ.LogWith(string.Format("%1 damaged", LogZ_Object.GetType(victim)), lvl, eventType, payload);
 			return;
 		}
 
 		if (source == victim) {
-			LogZ.Log(string.Format("%1 hit self", LogZ_Object.GetType(victim)), lvl, eventType, dto);
+			LogZ.LogWith(string.Format("%1 hit self", LogZ_Object.GetType(victim)), lvl, eventType, payload);
 			return;
 		}
 
-		dto.Insert("distance", LogZ_Utils.Distance(source, victim));
-
-		if (LogZ_GameLogger.SerializeObject(source, json))
-			dto.Insert("attacker", json);
+		payload.AddFloat("distance", LogZ_Utils.DistanceFloat(source, victim));
 
-		if (LogZ_GameLogger.SerializeParentObject(source, json))
-			dto.Insert("attacker_parent", json);
+		LogZ_GameLogger.AddObjectCached(payload, "attacker", source);
+		LogZ_GameLogger.AddParentObjectCached(payload, "attacker_parent", source);
 
-		LogZ.Log(string.Format("%1 hit", LogZ_Object.GetType(victim)), lvl, eventType, dto);
+		LogZ.LogWith(string.Format("%1 hit", LogZ_Object.GetType(victim)), lvl, eventType, payload);
 	}
 
 	/**
@@ -169,99 +162,91 @@ class LogZ_WorldLogger
 			msg = "action end";
 		}
 
-		ref map<string, string> dto = new map<string, string>();
-		string json;
+		LogZ_Payload payload = s_Payload;
+		payload.Reset();
+		s_ActionData.Load(action_data);
+		payload.AddObject("action_data", s_ActionData);
 
-		LogZ_DTO_ActionData actionDTO = new LogZ_DTO_ActionData(action_data);
-		if (LogZ.GetSerializer().WriteToString(actionDTO, false, json))
-			dto.Insert("action_data", json);
+		if (action_data.m_Player)
+			LogZ_GameLogger.AddObject(payload, "player", action_data.m_Player, true);
 
-		if (action_data.m_Player) {
-			if (LogZ_GameLogger.SerializeObject(action_data.m_Player, json, true))
-				dto.Insert("player", json);
-		}
-
-		if (action_data.m_MainItem) {
-			if (LogZ_GameLogger.SerializeObject(action_data.m_MainItem, json, true))
-				dto.Insert("item", json);
-		}
+		if (action_data.m_MainItem)
+			LogZ_GameLogger.AddObject(payload, "item", action_data.m_MainItem, true);
 
 		if (action_data.m_Target) {
 			Object targetObj = action_data.m_Target.GetObject();
 			if (targetObj && targetObj != action_data.m_MainItem) {
 				if (action_data.m_MainItem)
-					dto.Insert("distance", LogZ_Utils.Distance(targetObj, action_data.m_MainItem));
+					payload.AddFloat("distance", LogZ_Utils.DistanceFloat(targetObj, action_data.m_MainItem));
 				else if (action_data.m_Player)
-					dto.Insert("distance", LogZ_Utils.Distance(targetObj, action_data.m_Player));
+					payload.AddFloat("distance", LogZ_Utils.DistanceFloat(targetObj, action_data.m_Player));
 
-				if (LogZ_GameLogger.SerializeObject(targetObj, json))
-					dto.Insert("target", json);
+				LogZ_GameLogger.AddObject(payload, "target", targetObj);
 			}
 
 			Object targetParentObj = action_data.m_Target.GetParent();
 			if (targetParentObj && targetParentObj != action_data.m_Player) {
 				if (!targetObj && action_data.m_MainItem)
-					dto.Insert("distance", LogZ_Utils.Distance(targetParentObj, action_data.m_MainItem));
+					payload.AddFloat("distance", LogZ_Utils.DistanceFloat(targetParentObj, action_data.m_MainItem));
 				else if (!targetObj && action_data.m_Player)
-					dto.Insert("distance", LogZ_Utils.Distance(targetParentObj, action_data.m_Player));
+					payload.AddFloat("distance", LogZ_Utils.DistanceFloat(targetParentObj, action_data.m_Player));
 
-				if (LogZ_GameLogger.SerializeObject(targetParentObj, json))
-					dto.Insert("target_parent", json);
+				LogZ_GameLogger.AddObject(payload, "target_parent", targetParentObj);
 			}
 		}
 
-		LogZ.Log(msg, lvl, eventType, dto);
+		LogZ.LogWith(msg, lvl, eventType, payload);
 	}
 
 	/**
 	    \brief Resolve hit/kill event type by victim and hit flag.
+	    \details Category depends only on victim class and is cached per config type name.
+	             Every *_KILL event is the next bit after its *_HIT pair.
 	    \param victim Victim object.
 	    \param isHit  True for hit, false for kill.
 	    \return LogZ_Event Event type for this victim/hit combo.
 	*/
 	protected static LogZ_Event ResolveVictimEvent(Object victim, bool isHit)
 	{
-		if (victim.IsDayZCreature()) {
-			if (isHit)
-				return LogZ_Event.CREATURE_HIT;
-
-			return LogZ_Event.CREATURE_KILL;
+		int hitEvent;
+		string typeName = victim.GetType();
+		if (typeName == string.Empty)
+			hitEvent = ResolveVictimHitEvent(victim);
+		else if (!s_VictimHitEvents.Find(typeName, hitEvent)) {
+			hitEvent = ResolveVictimHitEvent(victim);
+			s_VictimHitEvents.Set(typeName, hitEvent);
 		}
 
-		if (victim.IsTransport()) {
-			if (isHit)
-				return LogZ_Event.TRANSPORT_HIT;
+		if (isHit)
+			return hitEvent;
 
-			return LogZ_Event.TRANSPORT_KILL;
-		}
+		return hitEvent << 1;
+	}
 
-		if (victim.CanUseConstruction() || victim.IsBuilding() || victim.IsFuelStation()) {
-			if (isHit)
-				return LogZ_Event.BUILDING_HIT;
+	/**
+	    \brief Resolve *_HIT event type of victim without cache.
+	*/
+	protected static LogZ_Event ResolveVictimHitEvent(Object victim)
+	{
+		if (victim.IsDayZCreature())
+			return LogZ_Event.CREATURE_HIT;
 
-			return LogZ_Event.BUILDING_KILL;
-		}
+		if (victim.IsTransport())
+			return LogZ_Event.TRANSPORT_HIT;
+
+		if (victim.CanUseConstruction() || victim.IsBuilding() || victim.IsFuelStation())
+			return LogZ_Event.BUILDING_HIT;
 
 		if (victim.IsMan()) {
 #ifdef EXPANSIONMODAI
-			if (victim.IsInherited(eAIBase)) {
-				if (isHit)
-					return LogZ_Event.CREATURE_HIT;
-
-				return LogZ_Event.CREATURE_KILL;
-			}
+			if (victim.IsInherited(eAIBase))
+				return LogZ_Event.CREATURE_HIT;
 #endif
 
-			if (isHit)
-				return LogZ_Event.PLAYER_HIT;
-
-			return LogZ_Event.PLAYER_KILL;
+			return LogZ_Event.PLAYER_HIT;
 		}
 
-		if (isHit)
-			return LogZ_Event.ENTITY_HIT;
-
-		return LogZ_Event.ENTITY_KILL;
+		return LogZ_Event.ENTITY_HIT;
 	}
 }
 #endif
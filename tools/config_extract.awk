@@ -139,6 +139,11 @@ in_comment_block {
     sub(/^ref /, "", clean_type)
     class_map[clean_type] = name
 
+    # array of DTOs: "array<ref LogZ_ConfigDTO_Route> routes" -> "routes[]."
+    elem_type = clean_type
+    if (sub(/^array<(ref )?/, "", elem_type) && sub(/>$/, "", elem_type))
+      class_map[elem_type] = name "[]"
+
     default_val = ""
     if (eq_idx > 0) {
       val_part = substr(line, eq_idx + 1, semi_idx - eq_idx - 1)